@@ -22,9 +22,6 @@
  *   15 D1
  *   16 D0
  *   17 RW
- *
- * TODO:
- *  - drawFastVLine
  */
 
 #ifndef T6A04A_H
@@ -33,7 +30,15 @@
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
 
+// the number of words a transaction can hold before it is written out early,
+// see `T6A04A::startWrite`. each costs four bytes of RAM.
+#ifndef T6A04A_TRANSACTION_WORDS
+#define T6A04A_TRANSACTION_WORDS 32
+#endif
+
 typedef unsigned char u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
 typedef u8 pin;
 
 const u8 Y_COUNT = 64;
@@ -45,11 +50,26 @@ const u8 ROW_COUNT = Y_COUNT;
 // can't compute COLUMN_COUNT because this depends on the display word size
 // which is configurable between 6 and 8 bits.
 
+// the display RAM is 120 pixels wide: 15 8-bit words, or 20 6-bit words.
+// the address counter wraps around within it.
+const u8 RAM_WIDTH = 120;
+
+// the size of a known map, one bit per 8-bit word on screen,
+// see `T6A04A::attach_known_map`.
+const u8 KNOWN_MAP_BYTES = Y_COUNT * (X_COUNT / 8) / 8;
+
 const u8 STANDBY_ENABLE = LOW;
 const u8 STANDBY_DISABLE = HIGH;
 const u8 RW_WRITE = LOW;
 const u8 RW_READ = HIGH;
 
+// drawing colors: any other non-zero color also turns pixels on.
+// INVERSE flips each drawn pixel, so drawing a shape twice restores the screen,
+// as long as the shape doesn't cover a pixel twice (like the corners of `drawRect`).
+const uint16_t T6A04A_OFF = 0;
+const uint16_t T6A04A_ON = 1;
+const uint16_t T6A04A_INVERSE = 2;
+
 typedef enum WriteMode {
     WRITE_INSTRUCTION = 1,
     WRITE_DATA = 2,
@@ -79,6 +99,69 @@ typedef struct CounterConfig {
     CounterDirection direction;
 } CounterConfig;
 
+// a rectangle of physical panel pixels, [x0, x1) x [y0, y1).
+typedef struct Region {
+    u8 x0;
+    u8 y0;
+    u8 x1;
+    u8 y1;
+} Region;
+
+// pixels of a line gathered into a run on the panel, see `T6A04A::writeLine`.
+typedef struct LineRun {
+    // gather the pixels of each word column (true), or of each row (false).
+    bool column_runs;
+    bool empty;
+    // the word column or the row of the run.
+    u8 at;
+    // the rows, or the pixel columns, [start, end) covered by the run.
+    u8 start;
+    u8 end;
+    // for column runs, the pixels of the run within each row.
+    u8 masks[64];
+} LineRun;
+
+// a GFXcanvas1 being drawn by `T6A04A::pushCanvas`:
+// its buffer of rows `bytes` bytes wide, and the panel position of its top-left pixel.
+typedef struct CanvasPush {
+    const u8 *buffer;
+    u8 bytes;
+    int16_t x;
+    int16_t y;
+} CanvasPush;
+
+// a GFXfont glyph placed on the panel by `T6A04A::write`:
+// its bitmap (in PROGMEM), and the top-left pixel and size of its box, in physical coordinates.
+typedef struct PlacedGlyph {
+    const u8 *bitmap;
+    int16_t x;
+    int16_t y;
+    u8 w;
+    u8 h;
+} PlacedGlyph;
+
+// a change to one word of display RAM, pending until the end of a transaction,
+// see `T6A04A::startWrite`.
+// the word becomes `(existing & keep) ^ flip`,
+// so it doesn't need to be read back when `keep` is zero.
+typedef struct PendingWord {
+    u8 row;
+    u8 column;
+    u8 keep;
+    u8 flip;
+} PendingWord;
+
+// how long the driver waits around each strobe, in microseconds,
+// see `T6A04A::set_timing` and calib.h.
+typedef struct Timing {
+    // after an instruction write, before the next strobe.
+    u8 instruction_us;
+    // after a data write, before the next strobe.
+    u8 data_us;
+    // after raising CE for a read, before sampling the data lines.
+    u8 read_us;
+} Timing;
+
 typedef enum WordLength {
     WORD_LENGTH_8 = 8,
     WORD_LENGTH_6 = 6,
@@ -87,6 +170,29 @@ typedef enum WordLength {
 // used to hold OUTPUT, INPUT
 typedef u8 IOMode;
 
+// an image packed into display words by tools/t6a04a_assets.py,
+// stored in the order the counter walks them, see `T6A04A::write_packed`.
+typedef struct PackedImage {
+    // PROGMEM, `lines * words_per_line` words.
+    const u8 *words;
+    WordLength word_length;
+    // ROW_WISE images are stored row by row, COLUMN_WISE images word column by word column.
+    CounterOrientation orientation;
+    // the width, in words.
+    u8 columns;
+    // the height, in pixels.
+    u8 rows;
+} PackedImage;
+
+// a fixed-cell font packed by tools/t6a04a_assets.py,
+// with the glyphs for characters [first, first + count) stored one after another.
+typedef struct PackedFont {
+    // the words of the first glyph, and the layout of every glyph.
+    PackedImage cell;
+    u8 first;
+    u8 count;
+} PackedFont;
+
 class Status {
 private:
     u8 inner;
@@ -140,72 +246,95 @@ public:
 };
 
 
-class T6A04A : public Adafruit_GFX
+// the data lines, DI and RW of several panels may be wired together,
+// with only CE (and optionally RST/STB) wired per panel.
+// the bus owns the shared lines and tracks their direction,
+// since any of the panels may flip it.
+//
+// the panel strobes CE itself, so a bus only needs to present
+// DI, RW and the data lines around each strobe:
+//  - `T6A04AParallelBus` drives the data lines from eight GPIO pins.
+//  - `T6A04AShiftBus` (shift.h) drives them through shift registers on SPI.
+class T6A04ABus
+{
+public:
+    // drive DI and the data lines, ready for a panel to be strobed.
+    virtual void put(bool di, u8 v) = 0;
+
+    // drive DI and release the data lines, ready for a panel to be strobed.
+    virtual void listen(bool di) = 0;
+
+    // sample the data lines while a panel is strobed.
+    virtual u8 get() = 0;
+};
+
+// writes deferred to the background, such as to a timer interrupt by `T6A04AEngine` (engine.h).
+// the queue strobes each write later through `T6A04A::strobe_write`,
+// and the panel fences it before anything else touches the bus or its pins.
+class T6A04AQueue
+{
+public:
+    // queue a write of `v` with the given DI level, waiting for room if the queue is full.
+    virtual void push(bool di, u8 v) = 0;
+
+    // block until every queued write has been strobed.
+    virtual void fence() = 0;
+};
+
+// a bus with every data line wired to its own GPIO pin.
+class T6A04AParallelBus : public T6A04ABus
 {
 private:
-    pin rst; // pin 3
-    pin stb; // pin 6
     pin di;  // pin 7
-    pin ce;  // ...
-    pin d7;
+    pin d7;  // pin 9
     pin d6;
     pin d5;
     pin d4;
     pin d3;
     pin d2;
     pin d1;
-    pin d0;
-    pin rw; // pin 17
+    pin d0;  // pin 16
+    pin rw;  // pin 17
 
-    CounterConfig counter_config;
-    WordLength word_length;
     IOMode io_mode;
 
-    void bus_write(WriteMode m, u8 v)
-    {
-        bool di = 0;
-        if (m == WriteMode::WRITE_INSTRUCTION) {
-            di = LOW;
-        } else if (m == WriteMode::WRITE_DATA) {
-            di = HIGH;
-        } else {
-            Serial.println("error: unexpected write mode");
-            abort();
-        }
-
-        digitalWrite(this->ce, LOW);
-        digitalWrite(this->di, di);
-        this->set_bus_mode(OUTPUT);
-
-        digitalWrite(this->d0, HIGH && (v & B00000001));
-        digitalWrite(this->d1, HIGH && (v & B00000010));
-        digitalWrite(this->d2, HIGH && (v & B00000100));
-        digitalWrite(this->d3, HIGH && (v & B00001000));
-        digitalWrite(this->d4, HIGH && (v & B00010000));
-        digitalWrite(this->d5, HIGH && (v & B00100000));
-        digitalWrite(this->d6, HIGH && (v & B01000000));
-        digitalWrite(this->d7, HIGH && (v & B10000000));
-
-        digitalWrite(this->ce, HIGH);
-
-        // "As mentioned, a 10 microsecond delay is required after sending the command"
-        // via: https://wikiti.brandonw.net/index.php?title=83Plus:Ports:10
-        delayMicroseconds(10);
-
-        digitalWrite(this->ce, LOW);
-    }
-
-    void write_instruction(u8 v)
-    {
-        this->bus_write(WriteMode::WRITE_INSTRUCTION, v);
-    }
-
-    void write_data(u8 v)
+public:
+    T6A04AParallelBus(
+        pin di,
+        pin d7,
+        pin d6,
+        pin d5,
+        pin d4,
+        pin d3,
+        pin d2,
+        pin d1,
+        pin d0,
+        pin rw)
+        : di(di),
+          d7(d7),
+          d6(d6),
+          d5(d5),
+          d4(d4),
+          d3(d3),
+          d2(d2),
+          d1(d1),
+          d0(d0),
+          rw(rw),
+          io_mode(OUTPUT)
     {
-        this->bus_write(WriteMode::WRITE_DATA, v);
+        pinMode(this->di, OUTPUT);
+        pinMode(this->rw, OUTPUT);
+        pinMode(this->d0, OUTPUT);
+        pinMode(this->d1, OUTPUT);
+        pinMode(this->d2, OUTPUT);
+        pinMode(this->d3, OUTPUT);
+        pinMode(this->d4, OUTPUT);
+        pinMode(this->d5, OUTPUT);
+        pinMode(this->d6, OUTPUT);
+        pinMode(this->d7, OUTPUT);
     }
 
-    void set_bus_mode(IOMode m)
+    void set_mode(IOMode m)
     {
         if (m != this->io_mode) {
             if (OUTPUT == m) {
@@ -213,7 +342,7 @@ private:
             } else if (INPUT == m) {
                 digitalWrite(this->rw, RW_READ);
             } else {
-                Serial.println("error: unexpected IO mode");
+                Serial.println(F("error: unexpected IO mode"));
                 abort();
             }
 
@@ -230,25 +359,29 @@ private:
         }
     }
 
-    u8 bus_read(ReadMode m)
+    virtual void put(bool di, u8 v) override
     {
-        digitalWrite(this->ce, LOW);
-        if (ReadMode::READ_STATUS == m) {
-            digitalWrite(this->di, LOW);
-        } else if (ReadMode::READ_DATA == m) {
-            digitalWrite(this->di, HIGH);
-        } else {
-            Serial.println("error: unexpected read mode");
-            abort();
-        }
-        this->set_bus_mode(INPUT);
+        digitalWrite(this->di, di);
+        this->set_mode(OUTPUT);
 
-        digitalWrite(this->ce, HIGH);
+        digitalWrite(this->d0, HIGH && (v & B00000001));
+        digitalWrite(this->d1, HIGH && (v & B00000010));
+        digitalWrite(this->d2, HIGH && (v & B00000100));
+        digitalWrite(this->d3, HIGH && (v & B00001000));
+        digitalWrite(this->d4, HIGH && (v & B00010000));
+        digitalWrite(this->d5, HIGH && (v & B00100000));
+        digitalWrite(this->d6, HIGH && (v & B01000000));
+        digitalWrite(this->d7, HIGH && (v & B10000000));
+    }
 
-        // "As mentioned, a 10 microsecond delay is required after sending the command"
-        // via: https://wikiti.brandonw.net/index.php?title=83Plus:Ports:10
-        delayMicroseconds(10);
+    virtual void listen(bool di) override
+    {
+        digitalWrite(this->di, di);
+        this->set_mode(INPUT);
+    }
 
+    virtual u8 get() override
+    {
         const u8 d0 = digitalRead(this->d0);
         const u8 d1 = digitalRead(this->d1);
         const u8 d2 = digitalRead(this->d2);
@@ -258,8 +391,6 @@ private:
         const u8 d6 = digitalRead(this->d6);
         const u8 d7 = digitalRead(this->d7);
 
-        digitalWrite(this->ce, LOW);
-
         return (
             (d7 << 7) |
             (d6 << 6) |
@@ -271,136 +402,1663 @@ private:
             d0
         );
     }
+};
+
+
+class T6A04A : public Adafruit_GFX
+{
+private:
+    pin rst; // pin 3
+    pin stb; // pin 6
+    pin ce;  // pin 8
+
+    // may be shared with other panels, see `T6A04ABus`.
+    T6A04ABus *bus;
+
+    // see `attach_queue`.
+    T6A04AQueue *queue;
+
+    CounterConfig counter_config;
+    WordLength word_length;
+
+    // cached so they can be restored, see `sync_config`.
+    bool display_enabled;
+    u8 contrast;
+    u8 z;
+
+    // when this panel was last strobed by a write, see `wait_ready`,
+    // and how long that write takes to settle.
+    u32 strobe_ts;
+    u8 settle_us;
+
+    // see `set_timing`.
+    Timing timing;
+
+    // see `startWrite`.
+    u8 write_depth;
+    u8 pending_count;
+    PendingWord pending[T6A04A_TRANSACTION_WORDS];
+
+    // see `set_standby_timeout`.
+    bool standby;
+    u32 standby_timeout_ms;
+    u32 active_ms;
+    u32 wake_us;
+
+    // see `bus_op_count`.
+    u32 op_count;
+
+    // see `attach_known_map`.
+    u8 *known;
+    u8 known_word;
+    u32 saved_reads;
+
+    // the address counter, tracked for the known map:
+    // the row, and the column in words of the current length.
+    u8 address_row;
+    u8 address_column;
+
+    // > As mentioned, a 10 microsecond delay is required after sending the command
+    // via: https://wikiti.brandonw.net/index.php?title=83Plus:Ports:10
+    //
+    // the delay is tracked per panel rather than spent inline,
+    // so that the caller (or another panel on the same bus) can use it.
+    // see `wait_ready`.
+    // since `micros` counts in steps of 4us on a 16MHz AVR,
+    // pad the deadline by that resolution.
+    //
+    // this is the default for every delay, which calib.h can shorten per panel.
+    static const u8 SETTLE_US = 10;
+    static const u8 MICROS_RESOLUTION = 4;
+
+    // the read delay is spent by `delayMicroseconds`, which returns at once
+    // for 0 or 1us on a 16MHz AVR, so shorter read delays are no delay at all.
+    static const u8 MIN_READ_US = 2;
 
-    // turn the given index on/off within the given word.
-    static inline u8 paint_pixel(u8 word, u8 index, bool color) {
-        if (color) {
-            return word | (0b10000000 >> index);
+    // the most glyphs of a line of text drawn together by `write`,
+    // each costs 8 bytes of stack.
+    static const u8 TEXT_GLYPHS = 8;
+
+    void bus_write(WriteMode m, u8 v)
+    {
+        bool di = 0;
+        if (m == WriteMode::WRITE_INSTRUCTION) {
+            di = LOW;
+        } else if (m == WriteMode::WRITE_DATA) {
+            di = HIGH;
         } else {
-            return word & ~(0b10000000 >> index);
+            Serial.println(F("error: unexpected write mode"));
+            abort();
+        }
+
+        if (this->standby) {
+            this->wake();
+        }
+        this->active_ms = millis();
+        this->op_count += 1;
+
+        if (this->queue != NULL) {
+            this->queue->push(di, v);
+            return;
         }
+
+        this->strobe_write(di, v);
     }
 
-public:
-    T6A04A(
-        pin rst,
-        pin stb,
-        pin di,
-        pin ce,
-        pin d7,
-        pin d6,
-        pin d5,
-        pin d4,
-        pin d3,
-        pin d2,
-        pin d1,
-        pin d0,
-        pin rw)
-        : rst(rst),
-          stb(stb),
-          di(di),
-          ce(ce),
-          d7(d7),
-          d6(d6),
-          d5(d5),
-          d4(d4),
-          d3(d3),
-          d2(d2),
-          d1(d1),
-          d0(d0),
-          rw(rw),
-          counter_config(CounterConfig { CounterOrientation::ROW_WISE, CounterDirection::INCREMENT }),
-          word_length(WordLength::WORD_LENGTH_8),
-          io_mode(OUTPUT),
-          Adafruit_GFX(96, 64)
+    // wait for whatever is left of the last write's settle time.
+    //
+    // the padding only makes sure a nonzero delay has passed in full,
+    // so a delay calibrated down to 0us doesn't wait at all.
+    void wait_settled()
     {
-        pinMode(this->ce, OUTPUT);
-        pinMode(this->di, OUTPUT);
-        pinMode(this->rw, OUTPUT);
-        pinMode(this->rst, OUTPUT);
-        pinMode(this->d0, OUTPUT);
-        pinMode(this->d1, OUTPUT);
-        pinMode(this->d2, OUTPUT);
-        pinMode(this->d3, OUTPUT);
-        pinMode(this->d4, OUTPUT);
-        pinMode(this->d5, OUTPUT);
-        pinMode(this->d6, OUTPUT);
-        pinMode(this->d7, OUTPUT);
-
-        // the LCD is reset when RST is pulsed low.
-        digitalWrite(this->rst, HIGH);
+        if (this->settle_us == 0) {
+            return;
+        }
 
-        digitalWrite(this->stb, STANDBY_DISABLE);
+        while ((u32)(micros() - this->strobe_ts) < (u32)this->settle_us + MICROS_RESOLUTION) {
+            // spin
+        }
     }
 
-    void init() {
-        this->reset();
+    // strobe every queued write, before driving the bus or the panel's pins directly.
+    void fence()
+    {
+        if (this->queue != NULL) {
+            this->queue->fence();
+        }
+    }
 
-        this->set_word_length(WordLength::WORD_LENGTH_8);
+    void write_instruction(u8 v)
+    {
+        this->bus_write(WriteMode::WRITE_INSTRUCTION, v);
+    }
 
-        this->enable_display();
-        this->set_contrast(48);
-        this->set_counter_orientation(CounterOrientation::ROW_WISE);
-        this->set_counter_direction(CounterDirection::INCREMENT);
-        this->set_column(0);
-        this->set_row(0);
-        this->set_z(0);
+    void write_data(u8 v)
+    {
+        this->bus_write(WriteMode::WRITE_DATA, v);
     }
 
-    // > When /RST = L, the reset function is executed and the following settings are mode.
-    // > (3)     Display..............................OFF
-    // > (4)     Word length..........................8 bits/word
-    // > (5)     Counter mode.........................Y-counter (row-counter)/up mode
-    // > (6)     Y-(page) address.....................Page = 0 (column 0)
-    // > (7)     X-address............................XAD  = 0 (row 0)
-    // > (8)     Z-address............................ZAD  = 0
-    // > (9)     Op-amp1 (OPA1) ......................min
-    // > (10)    Op-amp2 (OPA2) ......................min
-    void reset() {
-        digitalWrite(this->rst, LOW);
+    u8 bus_read(ReadMode m)
+    {
+        bool di = 0;
+        if (ReadMode::READ_STATUS == m) {
+            di = LOW;
+        } else if (ReadMode::READ_DATA == m) {
+            di = HIGH;
+        } else {
+            Serial.println(F("error: unexpected read mode"));
+            abort();
+        }
+
+        if (this->standby) {
+            this->wake();
+        }
+        this->active_ms = millis();
+        this->op_count += 1;
+
+        this->fence();
+
+        this->bus->listen(di);
+
+        this->wait_settled();
+
+        digitalWrite(this->ce, HIGH);
 
         // "As mentioned, a 10 microsecond delay is required after sending the command"
         // via: https://wikiti.brandonw.net/index.php?title=83Plus:Ports:10
-        delayMicroseconds(10);
+        //
+        // the panel drives the bus for the whole strobe,
+        // so this delay can't be shared with another panel.
+        delayMicroseconds(this->timing.read_us);
 
-        digitalWrite(this->rst, HIGH);
+        const u8 v = this->bus->get();
+
+        digitalWrite(this->ce, LOW);
+
+        return v;
     }
 
-    // set the word length used when write/reading data to the display.
-    // this seems to be useful to update either 8 or 6 bit regions quickly,
-    // e.g. when a character is 8 or 6 pixels wide.
+    // optimized implementation of a horizontal run of pixels [start_x, end_x)
+    // on the given physical row, taking advantage of the auto-incrementing
+    // counter and sequential 8-bit read/writes.
+    //
+    // the run must be non-empty and within the panel.
+    void hspan(u8 row, u8 start_x, u8 end_x, uint16_t color)
+    {
+        if (T6A04A_INVERSE != color) {
+            this->pattern_span(row, start_x, end_x, 0 != color ? 0b11111111 : 0b00000000);
+            return;
+        }
+
+        const u8 start_column = start_x / WordLength::WORD_LENGTH_8;
+        const u8 last_column = (end_x - 1) / WordLength::WORD_LENGTH_8;
+
+        if (this->write_depth > 0) {
+            for (u8 column = start_column; column <= last_column; column++) {
+                const u8 left = column * WordLength::WORD_LENGTH_8;
+                this->defer_word(
+                    row,
+                    column,
+                    span_mask(start_x > left ? start_x - left : 0, end_x - left < 8 ? end_x - left : 8),
+                    color);
+            }
+            return;
+        }
+
+        this->set_word_length(WordLength::WORD_LENGTH_8);
+        this->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        // every inverted pixel depends on the existing data,
+        // so read the whole run in one pass, and write it back in another.
+        //
+        // cost: 5 + 2 * words bus operations
+        u8 words[X_COUNT / WordLength::WORD_LENGTH_8];
+
+        bool known = this->known != NULL;
+        for (u8 i = start_column; i <= last_column && known; i++) {
+            known = this->is_known(row, i);
+        }
+
+        if (known) {
+            memset(words, this->known_word, sizeof(words));
+            this->saved_reads += last_column - start_column + 1;
+        } else {
+            this->set_row(row);
+            this->set_column(start_column);
+            this->read_word(); // dummy
+            for (u8 i = start_column; i <= last_column; i++) {
+                words[i] = this->read_word();
+            }
+        }
+
+        this->set_row(row);
+        this->set_column(start_column);
+        for (u8 i = start_column; i <= last_column; i++) {
+            const u8 left = i * WordLength::WORD_LENGTH_8;
+            const u8 right = left + WordLength::WORD_LENGTH_8;
+            this->write_word(words[i] ^ span_mask(
+                start_x > left ? start_x - left : 0,
+                end_x < right ? end_x - left : WordLength::WORD_LENGTH_8));
+        }
+    }
+
+    // set the pixels [start_x, end_x) of the given physical row to the matching
+    // pixels of `pattern`, a word repeated every 8 pixels along the row.
+    // solid runs use a pattern of all pixels on or off.
+    //
+    // the run must be non-empty and within the panel.
+    void pattern_span(u8 row, u8 start_x, u8 end_x, u8 pattern)
+    {
+        if (this->write_depth > 0) {
+            for (u8 column = start_x / WordLength::WORD_LENGTH_8; column * WordLength::WORD_LENGTH_8 < end_x; column++) {
+                const u8 left = column * WordLength::WORD_LENGTH_8;
+                const u8 mask = span_mask(start_x > left ? start_x - left : 0, end_x - left < 8 ? end_x - left : 8);
+                if ((mask & pattern) != 0) {
+                    this->defer_word(row, column, mask & pattern, T6A04A_ON);
+                }
+                if ((mask & ~pattern) != 0) {
+                    this->defer_word(row, column, mask & ~pattern, T6A04A_OFF);
+                }
+            }
+            return;
+        }
+
+        this->set_word_length(WordLength::WORD_LENGTH_8);
+        this->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        const u8 start_column = start_x / WordLength::WORD_LENGTH_8;
+        const u8 end_column = end_x / WordLength::WORD_LENGTH_8;
+
+        bool start_aligned = 0 == (start_x % WordLength::WORD_LENGTH_8);
+        bool end_aligned = 0 == (end_x % WordLength::WORD_LENGTH_8);
+
+        // there are two special cases:
+        //  1. only one word is partially overwritten, this takes one read and one write.
+        //  2. the line is word-aligned, we can blindly overwrite those words directly.
+        //
+        // in the general case, we need to read in the existing data,
+        // update it, and write it back out.
+        if (start_column == end_column) {
+            // case 1:
+            // all pixels in the same word
+            // 00xxxxxx00
+            const u8 mask = span_mask(start_x % WordLength::WORD_LENGTH_8, end_x % WordLength::WORD_LENGTH_8);
+
+            u8 word = this->read_word_known(row, start_column);
+            word = (word & ~mask) | (pattern & mask);
+            this->write_word_at(row, start_column, word);
+        } else if (start_aligned && end_aligned) {
+            // case 2:
+            // line with aligned edges
+            // 00000000 xxxxxxxx ... xxxxxxxx 00000000
+            this->set_row(row);
+            this->set_column(start_column);
+            for (u8 i = start_column; i < end_column; i++) {
+                // we can blindly overwrite the word
+                // because all bits will be set.
+                this->write_word(pattern);
+            }
+        } else {
+            // general case:
+            // multi-word line with at least one unaligned edge
+            // 00000xxx xxxxxxxx xxx00000
+            // 00000000 xxxxxxxx xxx00000
+            // 00000xxx xxxxxxxx 00000000
+
+            u8 start_word = this->known_word;
+            u8 end_word = this->known_word;
+
+            // read the unaligned start and end words, unless they are known.
+            // we don't care about the middle words (or an aligned edge),
+            // because we blindly overwrite them.
+            {
+                const bool read_start = !start_aligned && !this->is_known(row, start_column);
+                const bool read_end = !end_aligned && !this->is_known(row, end_column);
+                this->saved_reads += (!start_aligned && !read_start) + (!end_aligned && !read_end);
+
+                if (read_start || read_end) {
+                    this->set_row(row);
+                }
+
+                if (read_start) {
+                    this->set_column(start_column);
+                    this->read_word(); // dummy
+                    start_word = this->read_word();
+                }
+
+                if (read_end) {
+                    if (!read_start || start_column + 1 != end_column) {
+                        // if the start and end columns are adjacent,
+                        // its faster to just read the next word directly.
+                        // otherwise, seek to end column.
+                        this->set_column(end_column);
+                        this->read_word(); // dummy
+                    }
+
+                    end_word = this->read_word();
+                }
+            }
+
+            // write the affected row data (up to 12 bytes) in one pass
+            // relying on the counter to increment the address.
+            //
+            // each edge word is painted just before it is written,
+            // so the painting overlaps with the settle time of the previous write.
+            {
+                this->set_row(row);
+                this->set_column(start_column);
+
+                // unaligned left side
+                // 00000xxx ........
+                if (!start_aligned) {
+                    const u8 mask = span_mask(start_x % WordLength::WORD_LENGTH_8, WordLength::WORD_LENGTH_8);
+                    this->write_word((start_word & ~mask) | (pattern & mask));
+                }
+
+                // aligned middle
+                // ........ xxxxxxxx ........
+                //
+                // we can blindly overwrite the words
+                // because all bits will be set.
+                const u8 middle_column = start_aligned ? start_column : start_column + 1;
+                for (u8 i = middle_column; i < end_column; i++) {
+                    this->write_word(pattern);
+                }
+
+                // unaligned right side
+                // ........ xxx00000
+                if (!end_aligned) {
+                    const u8 mask = span_mask(0, end_x % WordLength::WORD_LENGTH_8);
+                    this->write_word((end_word & ~mask) | (pattern & mask));
+                }
+            }
+        }
+    }
+
+    // read-modify-write the words [start_y, end_y) of the given word column,
+    // taking advantage of the column-wise counter: the affected words are read
+    // in one pass and written back in another, rather than re-addressing each word.
+    //
+    // `masks[i]` selects the pixels to paint in row `start_y + i`,
+    // or when `masks` is NULL, `mask` selects the pixels in every row.
+    //
+    // the run must be non-empty and within the panel.
+    //
+    // cost: 5 + 2 * (end_y - start_y) bus operations
+    void column_span(u8 column, u8 start_y, u8 end_y, const u8 *masks, u8 mask, uint16_t color)
+    {
+        const u8 count = end_y - start_y;
+
+        if (this->write_depth > 0) {
+            if (count <= T6A04A_TRANSACTION_WORDS / 2) {
+                for (u8 i = 0; i < count; i++) {
+                    this->defer_word(start_y + i, column, masks == NULL ? mask : masks[i], color);
+                }
+                return;
+            }
+
+            // too long to be worth deferring,
+            // but pending words must land first to keep the drawing order.
+            this->flush_pending();
+        }
+
+        this->set_word_length(WordLength::WORD_LENGTH_8);
+        this->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+
+        // statically allocate enough space for an entire column (64 bytes),
+        // since this is trivially fast (stack allocation).
+        u8 words[Y_COUNT];
+
+        if (this->is_column_known(column, start_y, end_y)) {
+            memset(words, this->known_word, count);
+            this->saved_reads += count;
+        } else {
+            this->set_row(start_y);
+            this->set_column(column);
+            this->read_word(); // dummy
+            for (u8 i = 0; i < count; i++) {
+                words[i] = this->read_word();
+            }
+        }
+
+        this->set_row(start_y);
+        this->set_column(column);
+        for (u8 i = 0; i < count; i++) {
+            const u8 m = masks == NULL ? mask : masks[i];
+            this->write_word(this->paint_mask(words[i], m, color));
+        }
+    }
+
+    // optimized implementation of a vertical run of pixels [start_y, end_y)
+    // in the given physical pixel column, see `column_span`.
+    //
+    // cost: 5 + 2 * (end_y - start_y) bus operations
+    void vspan(u8 x, u8 start_y, u8 end_y, uint16_t color)
+    {
+        this->column_span(
+            x / WordLength::WORD_LENGTH_8,
+            start_y,
+            end_y,
+            NULL,
+            0b10000000 >> (x % WordLength::WORD_LENGTH_8),
+            color);
+    }
+
+    // fill a region of the panel, given in physical coordinates.
+    void fill_region(const Region &r, uint16_t color)
+    {
+        if (r.x1 - r.x0 == 1 && r.y1 - r.y0 > 1) {
+            this->vspan(r.x0, r.y0, r.y1, color);
+            return;
+        }
+
+        for (u8 row = r.y0; row < r.y1; row++) {
+            this->hspan(row, r.x0, r.x1, color);
+        }
+    }
+
+    // clip the rectangle [x, x + w) x [y, y + h), given in rotated (logical) coordinates,
+    // to the screen, and map it onto physical panel coordinates.
+    //
+    // a negative width or height extends the rectangle to the left or up.
+    //
+    // returns false if no pixels remain.
+    bool clip(int16_t x, int16_t y, int16_t w, int16_t h, Region &r) const
+    {
+        if (w < 0) {
+            // enforce w to be positive.
+            x = x + w;
+            w = -w;
+        }
+
+        if (h < 0) {
+            // enforce h to be positive.
+            y = y + h;
+            h = -h;
+        }
+
+        int16_t x0 = x < 0 ? 0 : x;
+        int16_t y0 = y < 0 ? 0 : y;
+        int16_t x1 = x + w > this->_width ? this->_width : x + w;
+        int16_t y1 = y + h > this->_height ? this->_height : y + h;
+
+        if (x0 >= x1 || y0 >= y1) {
+            return false;
+        }
+
+        switch (this->rotation) {
+        case 0:
+            r = Region { (u8)x0, (u8)y0, (u8)x1, (u8)y1 };
+            break;
+        case 1:
+            r = Region { (u8)(X_COUNT - y1), (u8)x0, (u8)(X_COUNT - y0), (u8)x1 };
+            break;
+        case 2:
+            r = Region { (u8)(X_COUNT - x1), (u8)(Y_COUNT - y1), (u8)(X_COUNT - x0), (u8)(Y_COUNT - y0) };
+            break;
+        case 3:
+            r = Region { (u8)y0, (u8)(Y_COUNT - x1), (u8)y1, (u8)(Y_COUNT - x0) };
+            break;
+        }
+
+        return true;
+    }
+
+    // map a point given in rotated (logical) coordinates onto physical panel coordinates,
+    // without clipping.
+    void map_point(int16_t &x, int16_t &y) const
+    {
+        int16_t t;
+        switch (this->rotation) {
+        case 1:
+            t = x;
+            x = X_COUNT - 1 - y;
+            y = t;
+            break;
+        case 2:
+            x = X_COUNT - 1 - x;
+            y = Y_COUNT - 1 - y;
+            break;
+        case 3:
+            t = x;
+            x = y;
+            y = Y_COUNT - 1 - t;
+            break;
+        }
+    }
+
+    // clip a copy of `n` pixels from `source` to `dest` along one axis,
+    // so that both ranges fall within [0, limit).
+    static void clip_copy(int16_t &source, int16_t &dest, int16_t &n, int16_t limit)
+    {
+        if (source < 0) {
+            dest -= source;
+            n += source;
+            source = 0;
+        }
+
+        if (dest < 0) {
+            source -= dest;
+            n += dest;
+            dest = 0;
+        }
+
+        if (source + n > limit) {
+            n = limit - source;
+        }
+
+        if (dest + n > limit) {
+            n = limit - dest;
+        }
+    }
+
+    // the 8 pixels [x, x + 8) of a row of words, indexed by word column,
+    // for -8 <= x < X_COUNT.
+    static u8 row_pixels(const u8 *words, int16_t x)
+    {
+        const int8_t column = (x + WordLength::WORD_LENGTH_8) / WordLength::WORD_LENGTH_8 - 1;
+        const u8 bit = (x + WordLength::WORD_LENGTH_8) % WordLength::WORD_LENGTH_8;
+        const u8 left = column < 0 ? 0 : words[column];
+        const u8 right = words[column + 1];
+        return (left << bit) | (right >> (WordLength::WORD_LENGTH_8 - bit));
+    }
+
+    // the 8 pixels [x, x + 8) of a row of a GFXcanvas1 `bytes` bytes wide.
+    // pixels left of the row are off, x must be at least -8.
+    static u8 canvas_pixels(const u8 *row, u8 bytes, int16_t x)
+    {
+        const int8_t column = (x + WordLength::WORD_LENGTH_8) / WordLength::WORD_LENGTH_8 - 1;
+        const u8 bit = (x + WordLength::WORD_LENGTH_8) % WordLength::WORD_LENGTH_8;
+        const u8 left = column < 0 ? 0 : row[column];
+        const u8 right = bit == 0 || column + 1 >= bytes ? 0 : row[column + 1];
+        return bit == 0 ? left : (left << bit) | (right >> (WordLength::WORD_LENGTH_8 - bit));
+    }
+
+    // write the physical region `r` from a canvas, row by row.
+    //
+    // cost: per row, 2 bus operations plus one per word, plus reading back the edge words
+    void push_canvas_rows(const CanvasPush &push, const Region &r)
+    {
+        const u8 start = r.x0 / WordLength::WORD_LENGTH_8;
+        const u8 end = (r.x1 - 1) / WordLength::WORD_LENGTH_8;
+        const u8 start_mask = span_mask(r.x0 % WordLength::WORD_LENGTH_8, start == end ? r.x1 - start * WordLength::WORD_LENGTH_8 : WordLength::WORD_LENGTH_8);
+        const u8 end_mask = span_mask(0, r.x1 - end * WordLength::WORD_LENGTH_8);
+
+        this->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        for (u8 row = r.y0; row < r.y1; row++) {
+            const u8 *pixels = push.buffer + (row - push.y) * push.bytes;
+
+            // read back only the partially overwritten edge words, unless they are known.
+            u8 start_word = 0;
+            u8 end_word = 0;
+            bool read_start = false;
+            if (start_mask != 0b11111111) {
+                read_start = !this->is_known(row, start);
+                start_word = this->read_word_known(row, start);
+            }
+            if (start != end && end_mask != 0b11111111) {
+                if (read_start && start + 1 == end) {
+                    // if the start and end columns are adjacent,
+                    // its faster to just read the next word directly.
+                    end_word = this->read_word();
+                } else {
+                    end_word = this->read_word_known(row, end);
+                }
+            }
+
+            this->set_row(row);
+            this->set_column(start);
+            for (u8 column = start; column <= end; column++) {
+                const u8 word = canvas_pixels(pixels, push.bytes, column * WordLength::WORD_LENGTH_8 - push.x);
+                if (column == start) {
+                    this->write_word((start_word & ~start_mask) | (word & start_mask));
+                } else if (column == end) {
+                    this->write_word((end_word & ~end_mask) | (word & end_mask));
+                } else {
+                    this->write_word(word);
+                }
+            }
+        }
+    }
+
+    // write the physical region `r` from a canvas, word column by word column,
+    // using the column-wise counter.
+    //
+    // cost: per word column, 2 bus operations plus one per row,
+    // plus 3 plus one per row to read back a partially overwritten column.
+    void push_canvas_columns(const CanvasPush &push, const Region &r)
+    {
+        const u8 start = r.x0 / WordLength::WORD_LENGTH_8;
+        const u8 end = (r.x1 - 1) / WordLength::WORD_LENGTH_8;
+        const u8 rows = r.y1 - r.y0;
+
+        this->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+
+        for (u8 column = start; column <= end; column++) {
+            const u8 left = column * WordLength::WORD_LENGTH_8;
+            const u8 mask = span_mask(
+                r.x0 > left ? r.x0 - left : 0,
+                r.x1 - left < WordLength::WORD_LENGTH_8 ? r.x1 - left : WordLength::WORD_LENGTH_8);
+
+            u8 existing[Y_COUNT];
+            if (mask != 0b11111111 && this->is_column_known(column, r.y0, r.y1)) {
+                memset(existing, this->known_word, rows);
+                this->saved_reads += rows;
+            } else if (mask != 0b11111111) {
+                this->set_row(r.y0);
+                this->set_column(column);
+                this->read_word(); // dummy
+                for (u8 i = 0; i < rows; i++) {
+                    existing[i] = this->read_word();
+                }
+            }
+
+            this->set_row(r.y0);
+            this->set_column(column);
+            for (u8 i = 0; i < rows; i++) {
+                const u8 *pixels = push.buffer + (r.y0 + i - push.y) * push.bytes;
+                const u8 word = canvas_pixels(pixels, push.bytes, left - push.x);
+                this->write_word(mask == 0b11111111 ? word : (existing[i] & ~mask) | (word & mask));
+            }
+        }
+    }
+
+    // the 8 pixels [x, x + 8) of a row of a GFXfont glyph `w` pixels wide,
+    // whose first pixel is bit `row_bit` of the glyph's (PROGMEM) bitmap.
+    // pixels outside the row are off.
+    static u8 glyph_pixels(const u8 *bitmap, u16 row_bit, int16_t x, u8 w)
+    {
+        if (x >= w || x <= -WordLength::WORD_LENGTH_8) {
+            return 0;
+        }
+
+        // the glyph pixels [first, last) fall within the word.
+        const u8 first = x < 0 ? 0 : x;
+        const u8 last = x + WordLength::WORD_LENGTH_8 < w ? x + WordLength::WORD_LENGTH_8 : w;
+
+        // glyph rows are packed back to back, so a row's pixels may span two bytes.
+        const u16 bit = row_bit + first;
+        const u8 offset = bit % 8;
+        u16 bits = pgm_read_byte(bitmap + bit / 8) << 8;
+        if (offset + (last - first) > 8) {
+            bits |= pgm_read_byte(bitmap + bit / 8 + 1);
+        }
+
+        const u8 pixels = u8((bits << offset) >> 8) & span_mask(0, last - first);
+        return pixels >> (first - x);
+    }
+
+    // paint the set pixels of a line of GFXfont glyphs, straight from their bitmaps,
+    // word column by word column: the rows of each column are decoded into masks,
+    // merged across the glyphs that share the column, and painted in one pass,
+    // see `column_span`.
+    // rows with nothing to paint above and below each column's pixels are skipped.
+    //
+    // overlapping glyphs paint their pixels in turn, as drawing them one by one would,
+    // so with T6A04A_INVERSE a pixel set in two glyphs is flipped twice.
+    //
+    // cost: per word column, 5 bus operations plus 2 per row
+    void draw_glyphs(const PlacedGlyph *glyphs, u8 count, uint16_t color)
+    {
+        // the bounding box of the glyphs, clipped to the panel.
+        int16_t x0 = X_COUNT;
+        int16_t y0 = Y_COUNT;
+        int16_t x1 = 0;
+        int16_t y1 = 0;
+        for (u8 i = 0; i < count; i++) {
+            const PlacedGlyph &g = glyphs[i];
+            x0 = g.x < x0 ? g.x : x0;
+            y0 = g.y < y0 ? g.y : y0;
+            x1 = g.x + g.w > x1 ? g.x + g.w : x1;
+            y1 = g.y + g.h > y1 ? g.y + g.h : y1;
+        }
+
+        x0 = x0 < 0 ? 0 : x0;
+        y0 = y0 < 0 ? 0 : y0;
+        x1 = x1 > X_COUNT ? X_COUNT : x1;
+        y1 = y1 > Y_COUNT ? Y_COUNT : y1;
+        if (x0 >= x1 || y0 >= y1) {
+            return;
+        }
+
+        u8 masks[Y_COUNT];
+        for (u8 column = x0 / WordLength::WORD_LENGTH_8; column <= (x1 - 1) / WordLength::WORD_LENGTH_8; column++) {
+            const int16_t left = column * WordLength::WORD_LENGTH_8;
+
+            // the rows [first, last] with pixels in this column.
+            u8 first = y1;
+            u8 last = y0;
+            for (u8 row = y0; row < y1; row++) {
+                u8 mask = 0;
+                for (u8 i = 0; i < count; i++) {
+                    const PlacedGlyph &g = glyphs[i];
+                    if (row < g.y || row >= g.y + g.h) {
+                        continue;
+                    }
+
+                    const u8 pixels = glyph_pixels(g.bitmap, (row - g.y) * g.w, left - g.x, g.w);
+                    mask = T6A04A_INVERSE == color ? mask ^ pixels : mask | pixels;
+                }
+
+                masks[row - y0] = mask;
+                if (mask != 0) {
+                    if (first == y1) {
+                        first = row;
+                    }
+                    last = row;
+                }
+            }
+
+            if (first == y1) {
+                continue;
+            }
+
+            this->column_span(column, first, last + 1, masks + (first - y0), 0, color);
+        }
+    }
+
+    // the glyph of character `c - first` of a GFXfont, whose glyph table is in PROGMEM.
+    static const GFXglyph *font_glyph(const GFXfont *font, u8 c)
+    {
+#ifdef __AVR__
+        return (const GFXglyph *)pgm_read_word(&font->glyph) + c;
+#else
+        return font->glyph + c;
+#endif
+    }
+
+    static const u8 *font_bitmap(const GFXfont *font)
+    {
+#ifdef __AVR__
+        return (const u8 *)pgm_read_word(&font->bitmap);
+#else
+        return font->bitmap;
+#endif
+    }
+
+    // copy the physical region `source` onto the equally sized `dest`, row by row.
+    // rows are copied in the order that reads each source row before it is overwritten,
+    // like memmove, and each row is shifted in a buffer, so any bit offset works.
+    //
+    // cost: per row, 5 bus operations plus one per source and destination word,
+    // plus reading back the destination edge words.
+    void copy_rows(const Region &source, const Region &dest)
+    {
+        const u8 rows = source.y1 - source.y0;
+        const int16_t shift = dest.x0 - source.x0;
+        const u8 source_start = source.x0 / WordLength::WORD_LENGTH_8;
+        const u8 source_end = (source.x1 - 1) / WordLength::WORD_LENGTH_8;
+        const u8 dest_start = dest.x0 / WordLength::WORD_LENGTH_8;
+        const u8 dest_end = (dest.x1 - 1) / WordLength::WORD_LENGTH_8;
+        const bool downward = dest.y0 > source.y0;
+
+        this->set_word_length(WordLength::WORD_LENGTH_8);
+        this->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        for (u8 i = 0; i < rows; i++) {
+            const u8 k = downward ? rows - 1 - i : i;
+            const u8 source_row = source.y0 + k;
+            const u8 dest_row = dest.y0 + k;
+
+            // indexed by word column, plus one spare word past the edge, see `row_pixels`.
+            u8 words[X_COUNT / WordLength::WORD_LENGTH_8 + 1] = { 0 };
+
+            // within one row, read the destination words along with the source words.
+            u8 first = source_start;
+            u8 last = source_end;
+            if (source_row == dest_row) {
+                first = first < dest_start ? first : dest_start;
+                last = last > dest_end ? last : dest_end;
+            }
+
+            this->set_row(source_row);
+            this->set_column(first);
+            this->read_word(); // dummy
+            for (u8 column = first; column <= last; column++) {
+                words[column] = this->read_word();
+            }
+
+            const u8 start_mask = span_mask(dest.x0 % WordLength::WORD_LENGTH_8, dest_start == dest_end ? dest.x1 - dest_start * WordLength::WORD_LENGTH_8 : WordLength::WORD_LENGTH_8);
+            const u8 end_mask = span_mask(0, dest.x1 - dest_end * WordLength::WORD_LENGTH_8);
+            u8 start_word = words[dest_start];
+            u8 end_word = words[dest_end];
+
+            // otherwise read back only the partially overwritten edge words.
+            if (source_row != dest_row) {
+                this->set_row(dest_row);
+
+                if (start_mask != 0b11111111) {
+                    this->set_column(dest_start);
+                    this->read_word(); // dummy
+                    start_word = this->read_word();
+                }
+
+                if (dest_start != dest_end && end_mask != 0b11111111) {
+                    if (start_mask == 0b11111111 || dest_start + 1 != dest_end) {
+                        this->set_column(dest_end);
+                        this->read_word(); // dummy
+                    }
+                    end_word = this->read_word();
+                }
+            }
+
+            this->set_row(dest_row);
+            this->set_column(dest_start);
+            for (u8 column = dest_start; column <= dest_end; column++) {
+                const u8 word = row_pixels(words, column * WordLength::WORD_LENGTH_8 - shift);
+                if (column == dest_start) {
+                    this->write_word((start_word & ~start_mask) | (word & start_mask));
+                } else if (column == dest_end) {
+                    this->write_word((end_word & ~end_mask) | (word & end_mask));
+                } else {
+                    this->write_word(word);
+                }
+            }
+        }
+    }
+
+    // copy the physical region `source` onto the equally sized `dest`,
+    // word column by word column, using the column-wise counter.
+    // the regions must be offset by a whole number of words horizontally.
+    // columns are copied in the order that reads each source column before it is overwritten,
+    // like memmove.
+    //
+    // cost: per word column, 5 bus operations plus 2 per row,
+    // plus 3 plus one per row to read back a partially overwritten column.
+    void copy_columns(const Region &source, const Region &dest)
+    {
+        const int8_t offset = (dest.x0 - source.x0) / WordLength::WORD_LENGTH_8;
+        const u8 rows = source.y1 - source.y0;
+        const u8 dest_start = dest.x0 / WordLength::WORD_LENGTH_8;
+        const u8 dest_end = (dest.x1 - 1) / WordLength::WORD_LENGTH_8;
+        const bool rightward = offset > 0;
+
+        this->set_word_length(WordLength::WORD_LENGTH_8);
+        this->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+
+        for (u8 i = 0; i <= dest_end - dest_start; i++) {
+            const u8 column = rightward ? dest_end - i : dest_start + i;
+            const u8 left = column * WordLength::WORD_LENGTH_8;
+            const u8 mask = span_mask(
+                dest.x0 > left ? dest.x0 - left : 0,
+                dest.x1 < left + WordLength::WORD_LENGTH_8 ? dest.x1 - left : WordLength::WORD_LENGTH_8);
+
+            // indexed by row.
+            u8 words[Y_COUNT];
+            u8 existing[Y_COUNT];
+
+            // within one column, read the destination words along with the source words.
+            u8 first = source.y0;
+            u8 last = source.y1;
+            if (offset == 0 && mask != 0b11111111) {
+                first = first < dest.y0 ? first : dest.y0;
+                last = last > dest.y1 ? last : dest.y1;
+            }
+
+            this->set_row(first);
+            this->set_column(column - offset);
+            this->read_word(); // dummy
+            for (u8 row = first; row < last; row++) {
+                words[row] = this->read_word();
+                existing[row] = words[row];
+            }
+
+            // otherwise read back only partially overwritten columns.
+            if (offset != 0 && mask != 0b11111111) {
+                this->set_row(dest.y0);
+                this->set_column(column);
+                this->read_word(); // dummy
+                for (u8 row = dest.y0; row < dest.y1; row++) {
+                    existing[row] = this->read_word();
+                }
+            }
+
+            // a fully overwritten column keeps nothing of the destination,
+            // whose words weren't read.
+            this->set_row(dest.y0);
+            this->set_column(column);
+            for (u8 k = 0; k < rows; k++) {
+                const u8 word = words[source.y0 + k];
+                if (mask == 0b11111111) {
+                    this->write_word(word);
+                } else {
+                    this->write_word((existing[dest.y0 + k] & ~mask) | (word & mask));
+                }
+            }
+        }
+    }
+
+    // paint the pending run of a line, if any.
+    void flush_line_run(LineRun &run, uint16_t color)
+    {
+        if (run.empty) {
+            return;
+        }
+
+        if (run.column_runs) {
+            this->column_span(run.at, run.start, run.end, &run.masks[run.start], 0, color);
+            memset(&run.masks[run.start], 0, run.end - run.start);
+        } else {
+            this->hspan(run.at, run.start, run.end, color);
+        }
+
+        run.empty = true;
+    }
+
+    // add a pixel, in physical coordinates within the panel, to a line's run,
+    // painting the pending run first if the pixel doesn't extend it.
+    void add_line_pixel(LineRun &run, u8 x, u8 y, uint16_t color)
+    {
+        const u8 at = run.column_runs ? x / WordLength::WORD_LENGTH_8 : y;
+        const u8 i = run.column_runs ? y : x;
+
+        if (!run.empty && run.at == at && i + 1 >= run.start && i <= run.end) {
+            if (i < run.start) {
+                run.start = i;
+            }
+            if (i >= run.end) {
+                run.end = i + 1;
+            }
+        } else {
+            this->flush_line_run(run, color);
+            run.empty = false;
+            run.at = at;
+            run.start = i;
+            run.end = i + 1;
+        }
+
+        if (run.column_runs) {
+            run.masks[y] |= 0b10000000 >> (x % WordLength::WORD_LENGTH_8);
+        }
+    }
+
+    // record painting the masked pixels of a word in the current transaction,
+    // writing out the pending words first if there's no room for it.
+    void defer_word(u8 row, u8 column, u8 mask, uint16_t color)
+    {
+        PendingWord *p = NULL;
+        for (u8 i = 0; i < this->pending_count; i++) {
+            if (this->pending[i].row == row && this->pending[i].column == column) {
+                p = &this->pending[i];
+                break;
+            }
+        }
+
+        if (p == NULL) {
+            if (this->pending_count == T6A04A_TRANSACTION_WORDS) {
+                this->flush_pending();
+            }
+
+            p = &this->pending[this->pending_count];
+            this->pending_count += 1;
+            *p = PendingWord { row, column, 0b11111111, 0b00000000 };
+        }
+
+        if (T6A04A_INVERSE == color) {
+            // inverted pixels still depend on the existing word.
+            p->flip ^= mask;
+            return;
+        }
+
+        // painted pixels no longer depend on the existing word.
+        p->keep &= ~mask;
+        if (0 != color) {
+            p->flip |= mask;
+        } else {
+            p->flip &= ~mask;
+        }
+    }
+
+    // sort the pending words along rows (row_wise) or columns,
+    // returning how many runs of adjacent words that makes.
+    u8 sort_pending(bool row_wise)
+    {
+        // insertion sort: there are only a few words, and they're often nearly sorted.
+        for (u8 i = 1; i < this->pending_count; i++) {
+            const PendingWord p = this->pending[i];
+            const u16 key = row_wise ? (p.row << 8) | p.column : (p.column << 8) | p.row;
+
+            u8 j = i;
+            for (; j > 0; j--) {
+                const PendingWord &q = this->pending[j - 1];
+                if ((row_wise ? (q.row << 8) | q.column : (q.column << 8) | q.row) <= key) {
+                    break;
+                }
+                this->pending[j] = q;
+            }
+            this->pending[j] = p;
+        }
+
+        u8 runs = 0;
+        for (u8 i = 0; i < this->pending_count; i++) {
+            if (i == 0 || !this->is_pending_adjacent(i, row_wise)) {
+                runs += 1;
+            }
+        }
+        return runs;
+    }
+
+    // does the pending word `i` directly follow word `i - 1`, along the counter?
+    bool is_pending_adjacent(u8 i, bool row_wise) const
+    {
+        const PendingWord &p = this->pending[i - 1];
+        const PendingWord &q = this->pending[i];
+        if (row_wise) {
+            return p.row == q.row && p.column + 1 == q.column;
+        } else {
+            return p.column == q.column && p.row + 1 == q.row;
+        }
+    }
+
+    // write the pending words of the transaction out to the panel,
+    // in counter-driven runs along whichever orientation needs fewer of them.
+    // a run is only read back if one of its words is partially painted.
+    //
+    // cost: per run, 2 bus operations plus one per word,
+    // and if read back, another 3 plus one per word.
+    void flush_pending()
+    {
+        if (this->pending_count == 0) {
+            return;
+        }
+
+        const u8 column_runs = this->sort_pending(false);
+        const u8 row_runs = this->sort_pending(true);
+        const bool row_wise = row_runs <= column_runs;
+        if (!row_wise) {
+            this->sort_pending(false);
+        }
+
+        this->set_word_length(WordLength::WORD_LENGTH_8);
+        if (row_wise) {
+            this->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+        } else {
+            this->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+        }
+
+        u8 existing[T6A04A_TRANSACTION_WORDS];
+        for (u8 i = 0; i < this->pending_count; ) {
+            u8 end = i + 1;
+            bool needs_read = this->pending[i].keep != 0;
+            while (end < this->pending_count && this->is_pending_adjacent(end, row_wise)) {
+                needs_read = needs_read || this->pending[end].keep != 0;
+                end += 1;
+            }
+
+            // known words don't need to be read either.
+            bool known = needs_read && this->known != NULL;
+            for (u8 j = i; j < end && known; j++) {
+                known = this->pending[j].keep == 0 || this->is_known(this->pending[j].row, this->pending[j].column);
+            }
+
+            if (known) {
+                for (u8 j = i; j < end; j++) {
+                    existing[j] = this->known_word;
+                }
+                this->saved_reads += end - i;
+                needs_read = false;
+            }
+
+            if (needs_read) {
+                this->set_row(this->pending[i].row);
+                this->set_column(this->pending[i].column);
+                this->read_word(); // dummy
+                for (u8 j = i; j < end; j++) {
+                    existing[j] = this->read_word();
+                }
+            }
+
+            this->set_row(this->pending[i].row);
+            this->set_column(this->pending[i].column);
+            for (u8 j = i; j < end; j++) {
+                const PendingWord &p = this->pending[j];
+                this->write_word(((needs_read || known ? existing[j] : 0) & p.keep) ^ p.flip);
+            }
+
+            i = end;
+        }
+
+        this->pending_count = 0;
+    }
+
+    // the bit of a word in the known map, see `attach_known_map`.
+    static u16 known_index(u8 row, u8 column)
+    {
+        return row * (X_COUNT / WordLength::WORD_LENGTH_8) + column;
+    }
+
+    // whether the word at the given address is known to hold `known_word`.
+    bool is_known(u8 row, u8 column) const
+    {
+        if (this->known == NULL) {
+            return false;
+        }
+
+        const u16 i = known_index(row, column);
+        return (this->known[i / 8] & (1 << (i % 8))) != 0;
+    }
+
+    // whether the words [start_y, end_y) of a word column are all known.
+    bool is_column_known(u8 column, u8 start_y, u8 end_y) const
+    {
+        if (this->known == NULL) {
+            return false;
+        }
+
+        for (u8 row = start_y; row < end_y; row++) {
+            if (!this->is_known(row, column)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // update the known map for a word written at the tracked address.
+    void note_write(u8 v)
+    {
+        if (this->word_length == WordLength::WORD_LENGTH_8) {
+            if (this->address_column >= X_COUNT / WordLength::WORD_LENGTH_8) {
+                return;
+            }
+
+            const u16 i = known_index(this->address_row, this->address_column);
+            if (v == this->known_word) {
+                this->known[i / 8] |= 1 << (i % 8);
+            } else {
+                this->known[i / 8] &= ~(1 << (i % 8));
+            }
+            return;
+        }
+
+        // a 6-bit word overlaps one or two 8-bit words, which are no longer known.
+        const u8 left = this->address_column * WordLength::WORD_LENGTH_6;
+        const u8 right = left + WordLength::WORD_LENGTH_6 - 1;
+        for (u8 x = left; x <= right && x < X_COUNT; x += right - left) {
+            const u16 i = known_index(this->address_row, x / WordLength::WORD_LENGTH_8);
+            this->known[i / 8] &= ~(1 << (i % 8));
+        }
+    }
+
+    // move the tracked address like the panel's counter, after a data read or write.
+    void advance_address()
+    {
+        const bool increment = this->counter_config.direction == CounterDirection::INCREMENT;
+        if (this->counter_config.orientation == CounterOrientation::ROW_WISE) {
+            const u8 columns = RAM_WIDTH / this->word_length;
+            this->address_column = increment
+                ? (this->address_column + 1) % columns
+                : (this->address_column + columns - 1) % columns;
+        } else {
+            this->address_row = increment
+                ? (this->address_row + 1) % Y_COUNT
+                : (this->address_row + Y_COUNT - 1) % Y_COUNT;
+        }
+    }
+
+    // read the word at the given coordinates, unless it's known, see `read_word_at`.
+    //
+    // cost: four bus operations, or none if the word is known
+    u8 read_word_known(u8 row, u8 column)
+    {
+        if (this->is_known(row, column)) {
+            this->saved_reads += 1;
+            return this->known_word;
+        }
+
+        return this->read_word_at(row, column);
+    }
+
+    void init_pins()
+    {
+        pinMode(this->ce, OUTPUT);
+        pinMode(this->rst, OUTPUT);
+        pinMode(this->stb, OUTPUT);
+
+        // the LCD latches the bus when CE is pulsed high.
+        digitalWrite(this->ce, LOW);
+
+        // the LCD is reset when RST is pulsed low.
+        digitalWrite(this->rst, HIGH);
+
+        digitalWrite(this->stb, STANDBY_DISABLE);
+    }
+
+    // turn the given index on/off (or invert it) within the given word.
+    static inline u8 paint_pixel(u8 word, u8 index, uint16_t color) {
+        return paint_mask(word, 0b10000000 >> index, color);
+    }
+
+    // the pixels [left, right) of a word.
+    static inline u8 span_mask(u8 left, u8 right) {
+        return (0b11111111 >> left) & ~(0b11111111 >> right);
+    }
+
+    // turn the pixels selected by the mask on/off (or invert them) within the given word.
+    static inline u8 paint_mask(u8 word, u8 mask, uint16_t color) {
+        if (T6A04A_INVERSE == color) {
+            return word ^ mask;
+        } else if (0 != color) {
+            return word | mask;
+        } else {
+            return word & ~mask;
+        }
+    }
+
+public:
+    T6A04A(
+        pin rst,
+        pin stb,
+        pin di,
+        pin ce,
+        pin d7,
+        pin d6,
+        pin d5,
+        pin d4,
+        pin d3,
+        pin d2,
+        pin d1,
+        pin d0,
+        pin rw)
+        : Adafruit_GFX(96, 64),
+          rst(rst),
+          stb(stb),
+          ce(ce),
+          bus(new T6A04AParallelBus(di, d7, d6, d5, d4, d3, d2, d1, d0, rw)),
+          queue(NULL),
+          counter_config(CounterConfig { CounterOrientation::ROW_WISE, CounterDirection::INCREMENT }),
+          word_length(WordLength::WORD_LENGTH_8),
+          display_enabled(false),
+          contrast(0),
+          z(0),
+          strobe_ts(0),
+          settle_us(SETTLE_US),
+          timing(default_timing()),
+          write_depth(0),
+          pending_count(0),
+          standby(false),
+          standby_timeout_ms(0),
+          active_ms(0),
+          wake_us(0),
+          op_count(0),
+          known(NULL),
+          known_word(0),
+          saved_reads(0),
+          address_row(0),
+          address_column(0)
+    {
+        this->init_pins();
+    }
+
+    // a panel on the given bus, such as a `T6A04AShiftBus`,
+    // or one that shares its data lines, DI and RW with other panels.
+    // panels may also share RST and STB,
+    // in which case reset them together via `T6A04AMulti`.
+    T6A04A(
+        T6A04ABus *bus,
+        pin rst,
+        pin stb,
+        pin ce)
+        : Adafruit_GFX(96, 64),
+          rst(rst),
+          stb(stb),
+          ce(ce),
+          bus(bus),
+          queue(NULL),
+          counter_config(CounterConfig { CounterOrientation::ROW_WISE, CounterDirection::INCREMENT }),
+          word_length(WordLength::WORD_LENGTH_8),
+          display_enabled(false),
+          contrast(0),
+          z(0),
+          strobe_ts(0),
+          settle_us(SETTLE_US),
+          timing(default_timing()),
+          write_depth(0),
+          pending_count(0),
+          standby(false),
+          standby_timeout_ms(0),
+          active_ms(0),
+          wake_us(0),
+          op_count(0),
+          known(NULL),
+          known_word(0),
+          saved_reads(0),
+          address_row(0),
+          address_column(0)
+    {
+        this->init_pins();
+    }
+
+    void init() {
+        this->reset();
+        this->configure();
+    }
+
+    // apply the driver's default configuration, without resetting the panel.
+    //
+    // the panel may not hold the cached registers, such as when it was reset
+    // through a RST line shared with another panel, so unlike `set_word_length`
+    // and `set_counter_config`, this writes them even if the cache already matches.
+    void configure() {
+        this->word_length = WordLength::WORD_LENGTH_8;
+        this->write_word_length();
+
+        this->enable_display();
+        this->set_contrast(48);
+        this->counter_config = CounterConfig { CounterOrientation::ROW_WISE, CounterDirection::INCREMENT };
+        this->write_counter_config();
+        this->set_column(0);
+        this->set_row(0);
+        this->set_z(0);
+    }
+
+    // > When /RST = L, the reset function is executed and the following settings are mode.
+    // > (3)     Display..............................OFF
+    // > (4)     Word length..........................8 bits/word
+    // > (5)     Counter mode.........................Y-counter (row-counter)/up mode
+    // > (6)     Y-(page) address.....................Page = 0 (column 0)
+    // > (7)     X-address............................XAD  = 0 (row 0)
+    // > (8)     Z-address............................ZAD  = 0
+    // > (9)     Op-amp1 (OPA1) ......................min
+    // > (10)    Op-amp2 (OPA2) ......................min
+    void reset() {
+        this->fence();
+
+        digitalWrite(this->rst, LOW);
+
+        // "As mentioned, a 10 microsecond delay is required after sending the command"
+        // via: https://wikiti.brandonw.net/index.php?title=83Plus:Ports:10
+        delayMicroseconds(10);
+
+        digitalWrite(this->rst, HIGH);
+
+        this->counter_config = CounterConfig { CounterOrientation::ROW_WISE, CounterDirection::INCREMENT };
+        this->word_length = WordLength::WORD_LENGTH_8;
+        this->display_enabled = false;
+        this->z = 0;
+        this->address_row = 0;
+        this->address_column = 0;
+    }
+
+    // set the word length used when write/reading data to the display.
+    // this seems to be useful to update either 8 or 6 bit regions quickly,
+    // e.g. when a character is 8 or 6 pixels wide.
     //
     // this doesn't affect the total number of required pins,
     // only the display word size.
     //
-    // command: 86E
+    // this trusts the cached word length, for the drawing paths that call it
+    // before every operation. see `configure` and `restore_config`,
+    // which write it regardless.
+    //
+    // command: 86E
+    //
+    // cost: one bus operation, or none if the word length is unchanged
+    void set_word_length(WordLength wl)
+    {
+        if (wl == this->word_length) {
+            return;
+        }
+
+        this->word_length = wl;
+        this->write_word_length();
+    }
+
+    // send the cached word length to the panel.
+    //
+    // cost: one bus operation
+    void write_word_length()
+    {
+        const WordLength wl = this->word_length;
+        if (wl == WordLength::WORD_LENGTH_8) {
+            this->write_instruction(0b00000001);
+        } else if (wl == WordLength::WORD_LENGTH_6) {
+            this->write_instruction(0b00000000);
+        } else {
+            Serial.println(F("error: unexpected word length"));
+            abort();
+        }
+    }
+
+    // > When /STB = L, the T6A04A is in standby state.
+    // > The internal oscillator is stopped, power consumption is
+    // > reduced, and the power supply level for the LCD (VLC1 to VLC5) becomes VDD.
+    //
+    // the next bus operation leaves standby again, see `wake`.
+    void enable_standby() {
+        this->fence();
+        digitalWrite(this->stb, STANDBY_ENABLE);
+        this->standby = true;
+    }
+
+    // > When /STB = L, the T6A04A is in standby state.
+    // > The internal oscillator is stopped, power consumption is
+    // > reduced, and the power supply level for the LCD (VLC1 to VLC5) becomes VDD.
+    void disable_standby() {
+        digitalWrite(this->stb, STANDBY_DISABLE);
+        this->standby = false;
+    }
+
+    bool is_standby() const
+    {
+        return this->standby;
+    }
+
+    // leave standby, and restore any configuration the panel lost meanwhile.
+    // this happens transparently on the first bus operation after standby,
+    // and its duration is available from `wake_latency_us`.
+    //
+    // cost: one bus operation, plus one per restored register
+    void wake()
+    {
+        const u32 ts0 = micros();
+
+        this->disable_standby();
+        this->sync_config();
+
+        this->wake_us = micros() - ts0;
+    }
+
+    // the duration of the most recent `wake`, in microseconds.
+    u32 wake_latency_us() const
+    {
+        return this->wake_us;
+    }
+
+    // the delays of the datasheet-derived 10us settle time, which every panel starts with.
+    static Timing default_timing()
+    {
+        return Timing { SETTLE_US, SETTLE_US, SETTLE_US };
+    }
+
+    // the shortest delays `set_timing` uses.
+    static Timing min_timing()
+    {
+        return Timing { 0, 0, MIN_READ_US };
+    }
+
+    // the steps in which the delays make a difference:
+    // the write delays are timed with `micros`, which counts in steps of 4us
+    // on a 16MHz AVR, while the read delay is spent by `delayMicroseconds`.
+    static Timing timing_resolution()
+    {
+        return Timing { MICROS_RESOLUTION, MICROS_RESOLUTION, 1 };
+    }
+
+    // use shorter (or longer) delays around each strobe,
+    // such as those measured for this panel and its wiring by `T6A04ACalibration`.
+    // the delays apply from the next bus operation, and survive `reset`.
+    //
+    // a read delay below `min_timing` is lengthened to it.
+    void set_timing(Timing t)
+    {
+        if (t.read_us < MIN_READ_US) {
+            t.read_us = MIN_READ_US;
+        }
+
+        this->timing = t;
+    }
+
+    Timing current_timing() const
+    {
+        return this->timing;
+    }
+
+    // hand every write to `queue` to be strobed later, such as from a timer interrupt,
+    // so drawing only pays for queueing the writes, see engine.h.
+    // reads, resets and standby first wait for the queue to drain.
+    //
+    // the queue must own the bus: no other panel on it can be driven meanwhile.
+    // NULL drains the queue and goes back to strobing writes directly.
+    void attach_queue(T6A04AQueue *queue)
+    {
+        this->fence();
+        this->queue = queue;
+    }
+
+    // the number of bus operations (strobes) since the panel was constructed,
+    // for comparing the cost of drawing routines, see `fuzz_T6A04A`.
+    // the count wraps around.
+    u32 bus_op_count() const
+    {
+        return this->op_count;
+    }
+
+    // track which words of display RAM hold a known value, in `map`
+    // (KNOWN_MAP_BYTES, 96 bytes, one bit per 8-bit word on screen),
+    // so drawing can skip reading back the words it partially overwrites.
+    // this gets most of the benefit of a frame buffer for an eighth of its RAM,
+    // when drawing onto a cleared screen.
+    //
+    // `fillScreen` (and `clear`) make every word known to hold its fill,
+    // and every 8-bit word written through the driver stays known if it still holds it.
+    // 6-bit words, and writes while the map isn't attached, aren't tracked,
+    // so attaching the map starts with every word unknown.
+    //
+    // NULL detaches the map.
+    void attach_known_map(u8 *map)
+    {
+        this->known = map;
+        if (map != NULL) {
+            memset(map, 0, KNOWN_MAP_BYTES);
+        }
+    }
+
+    // forget every known word, such as after drawing on the panel
+    // by other means than this driver.
+    void forget_known()
+    {
+        if (this->known != NULL) {
+            memset(this->known, 0, KNOWN_MAP_BYTES);
+        }
+    }
+
+    // prepare for overwriting every word of the panel with `word`,
+    // by other means than `fillScreen`, such as `T6A04AMulti::fillScreen`:
+    // drop the pending words of a transaction, which the fill overwrites,
+    // and make `word` the known value, so every word written with it becomes known.
+    void begin_fill(u8 word)
+    {
+        this->pending_count = 0;
+
+        if (this->known != NULL) {
+            this->known_word = word;
+            memset(this->known, 0, KNOWN_MAP_BYTES);
+        }
+    }
+
+    // the number of word reads skipped thanks to the known map.
+    // the count wraps around.
+    u32 saved_read_count() const
+    {
+        return this->saved_reads;
+    }
+
+    // enter standby once no bus operation has happened for the given duration,
+    // as checked by `tick`. zero (the default) never enters standby.
+    //
+    // panels that share an STB line enter standby together,
+    // so time them with `T6A04AMulti::set_standby_timeout` instead.
+    void set_standby_timeout(u32 idle_ms)
+    {
+        this->standby_timeout_ms = idle_ms;
+        this->active_ms = millis();
+    }
+
+    // the time since the last bus operation, in milliseconds.
+    u32 idle_ms() const
+    {
+        return millis() - this->active_ms;
+    }
+
+    // enter standby if the panel has been idle for the standby timeout,
+    // measured from the last bus operation.
+    // call this regularly, e.g. from `loop()`.
+    //
+    // cost: no bus operations
+    void tick()
+    {
+        if (this->standby_timeout_ms != 0
+                && !this->standby
+                && millis() - this->active_ms >= this->standby_timeout_ms) {
+            this->enable_standby();
+        }
+    }
+
+    // compare the panel's status against the cached configuration,
+    // and re-apply only the registers that differ, see `restore_config`.
+    //
+    // returns the number of registers re-applied.
+    //
+    // cost: one bus operation, plus one per restored register
+    u8 sync_config()
+    {
+        Status s = this->read_status();
+        for (u8 i = 0; s.is_busy() && i < 8; i++) {
+            // the oscillator may still be starting up, e.g. after standby.
+            s = this->read_status();
+        }
+
+        return this->restore_config(s);
+    }
+
+    // compare a status read from the panel against the cached configuration,
+    // and re-apply only the registers that differ.
+    //
+    // the contrast and Z address can't be read back, so they are re-applied only along with
+    // the display, when the display was unexpectedly turned off (as by a reset,
+    // which also sets Z back to 0).
+    //
+    // returns the number of registers re-applied.
     //
-    // cost: one bus operation
-    void set_word_length(WordLength wl)
+    // cost: one bus operation per restored register, at most five
+    u8 restore_config(Status s)
     {
-        this->word_length = wl;
-        if (wl == WordLength::WORD_LENGTH_8) {
-            this->write_instruction(0b00000001);
-        } else if (wl == WordLength::WORD_LENGTH_6) {
-            this->write_instruction(0b00000000);
-        } else {
-            Serial.println("error: unexpected word length");
-            abort();
+        u8 restored = 0;
+
+        if (s.word_length() != this->word_length) {
+            this->write_word_length();
+            restored += 1;
         }
-    }
 
-    // > When /STB = L, the T6A04A is in standby state.
-    // > The internal oscillator is stopped, power consumption is
-    // > reduced, and the power supply level for the LCD (VLC1 to VLC5) becomes VDD.
-    void enable_standby() {
-        digitalWrite(this->stb, STANDBY_ENABLE);
-    }
+        if (s.counter_orientation() != this->counter_config.orientation
+                || s.counter_direction() != this->counter_config.direction) {
+            this->write_counter_config();
+            restored += 1;
+        }
 
-    // > When /STB = L, the T6A04A is in standby state.
-    // > The internal oscillator is stopped, power consumption is
-    // > reduced, and the power supply level for the LCD (VLC1 to VLC5) becomes VDD.
-    void disable_standby() {
-        digitalWrite(this->stb, STANDBY_DISABLE);
+        if (this->display_enabled && !s.is_enabled()) {
+            this->enable_display();
+            this->set_contrast(this->contrast);
+            restored += 2;
+
+            if (this->z != 0) {
+                this->set_z(this->z);
+                restored += 1;
+            }
+        }
+
+        return restored;
     }
 
     // > This command sets the contrast for the LCD.
@@ -411,6 +2069,7 @@ public:
     // cost: one bus operation
     void set_contrast(u8 contrast)
     {
+        this->contrast = contrast;
         this->write_instruction(0b11000000 | (contrast & 0b00111111));
     }
 
@@ -421,6 +2080,7 @@ public:
     // cost: one bus operation
     void enable_display()
     {
+        this->display_enabled = true;
         this->write_instruction(0b00000011);
     }
 
@@ -431,6 +2091,7 @@ public:
     // cost: one bus operation
     void disable_display()
     {
+        this->display_enabled = false;
         this->write_instruction(0b00000010);
     }
 
@@ -441,6 +2102,26 @@ public:
         }
 
         this->counter_config = CounterConfig { o, d };
+        this->write_counter_config();
+    }
+
+    void set_counter_orientation(CounterOrientation o)
+    {
+        this->set_counter_config(o, this->counter_config.direction);
+    }
+
+    void set_counter_direction(CounterDirection d)
+    {
+        this->set_counter_config(this->counter_config.orientation, d);
+    }
+
+    // send the cached counter config to the panel.
+    //
+    // cost: one bus operation
+    void write_counter_config()
+    {
+        const CounterOrientation o = this->counter_config.orientation;
+        const CounterDirection d = this->counter_config.direction;
         u8 command = 0b00000100;
 
         if (o == CounterOrientation::ROW_WISE) {
@@ -448,7 +2129,7 @@ public:
         } else if (o == CounterOrientation::COLUMN_WISE) {
             // pass: bit is unset
         } else {
-            Serial.println("error: unexpected counter orientation");
+            Serial.println(F("error: unexpected counter orientation"));
             abort();
         }
 
@@ -457,23 +2138,13 @@ public:
         } else if (d == CounterDirection::DECREMENT) {
             // pass: bit is unset
         } else {
-            Serial.println("error: unexpected counter direction");
+            Serial.println(F("error: unexpected counter direction"));
             abort();
         }
 
         this->write_instruction(command);
     }
 
-    void set_counter_orientation(CounterOrientation o)
-    {
-        this->set_counter_config(o, this->counter_config.direction);
-    }
-
-    void set_counter_direction(CounterDirection d)
-    {
-        this->set_counter_config(this->counter_config.orientation, d);
-    }
-
     // set the column coordinate for subsequent call to `write_byte`.
     // column zero is the left-most column.
     // note that the unit here is in 8 (or 6)-bit bytes, not pixels.
@@ -488,6 +2159,7 @@ public:
     // cost: one bus operation
     void set_column(u8 column)
     {
+        this->address_column = column & 0b00011111;
         this->write_instruction(0b00100000 | (column & 0b00011111));
     }
 
@@ -503,6 +2175,7 @@ public:
     // cost: one bus operation
     void set_row(u8 row)
     {
+        this->address_row = row & 0b00111111;
         this->write_instruction(0b10000000 | (row & 0b00111111));
     }
 
@@ -517,7 +2190,8 @@ public:
     // cost: one bus operation
     void set_z(u8 z)
     {
-        this->write_instruction(0b01000000 | (z & 0b00111111));
+        this->z = z & 0b00111111;
+        this->write_instruction(0b01000000 | this->z);
     }
 
     // write a word of data to the LCD, left-to-right.
@@ -528,10 +2202,51 @@ public:
     // the internal counter dictates how the address is incremented after a write.
     // see `set_counter_direction` for more information.
     //
+    // this returns as soon as the panel latches the word,
+    // without waiting for it to settle (see `wait_ready`),
+    // so compute the next word between writes rather than up front.
+    //
     // cost: one bus operation
     void write_word(u8 v)
     {
+        if (this->known != NULL) {
+            this->note_write(v);
+        }
         this->write_data(v);
+        this->advance_address();
+    }
+
+    // block until the panel has settled after the last write,
+    // including any writes still queued, see `attach_queue`.
+    //
+    // each bus operation already waits for whatever is left of
+    // the previous write's settle time, so this is only needed
+    // to measure a write, or to emulate a blocking write.
+    //
+    // cost: up to the settle time of the last write (10us by default), no bus operations
+    void wait_ready()
+    {
+        this->fence();
+        this->wait_settled();
+    }
+
+    // strobe a write onto the bus, once the previous write has settled.
+    // this is the second half of every write, which a `T6A04AQueue` calls
+    // for each write it queued, typically from an interrupt.
+    //
+    // cost: one bus operation, not counted by `bus_op_count`
+    void strobe_write(bool di, u8 v)
+    {
+        // setting up the bus overlaps with the settle time of the previous write.
+        this->bus->put(di, v);
+
+        this->wait_settled();
+
+        digitalWrite(this->ce, HIGH);
+        digitalWrite(this->ce, LOW);
+
+        this->strobe_ts = micros();
+        this->settle_us = di == LOW ? this->timing.instruction_us : this->timing.data_us;
     }
 
     // naive clear of the LCD by writing zeros to all pixels.
@@ -574,7 +2289,9 @@ public:
     // cost: one bus operation
     u8 read_word()
     {
-        return this->bus_read(ReadMode::READ_DATA);
+        const u8 v = this->bus_read(ReadMode::READ_DATA);
+        this->advance_address();
+        return v;
     }
 
     // read the word at the given coordinates.
@@ -606,9 +2323,53 @@ public:
         this->write_word(word);
     }
 
+    // stream a packed image to the panel with its top-left word at the given address,
+    // in its own word length: with 6-bit words, `column` counts 6 pixel units.
+    // the words are stored in the order the counter walks them,
+    // so each line (a row, or a word column) takes one address setup
+    // and then sequential writes straight from flash.
+    //
+    // this changes the word length and counter config to the image's.
+    //
+    // cost: (2 + words per line) bus operations per line
+    void write_packed(u8 row, u8 column, const PackedImage &image)
+    {
+        this->set_word_length(image.word_length);
+        this->set_counter_config(image.orientation, CounterDirection::INCREMENT);
+
+        const bool row_wise = image.orientation == CounterOrientation::ROW_WISE;
+        const u8 lines = row_wise ? image.rows : image.columns;
+        const u8 length = row_wise ? image.columns : image.rows;
+
+        const u8 *words = image.words;
+        for (u8 line = 0; line < lines; line++) {
+            this->set_row(row_wise ? row + line : row);
+            this->set_column(row_wise ? column : column + line);
+            for (u8 i = 0; i < length; i++) {
+                this->write_word(pgm_read_byte(words));
+                words += 1;
+            }
+        }
+    }
+
+    // stream the glyph of a packed font for the given character, see `write_packed`.
+    // characters missing from the font are skipped.
+    //
+    // cost: (2 + words per line) bus operations per line
+    void write_glyph(u8 row, u8 column, const PackedFont &font, u8 c)
+    {
+        if (c < font.first || c - font.first >= font.count) {
+            return;
+        }
+
+        PackedImage glyph = font.cell;
+        glyph.words += (c - font.first) * glyph.columns * glyph.rows;
+        this->write_packed(row, column, glyph);
+    }
+
     // naive update of a single pixel at a given (x, y) location.
     //
-    // note this assumes 8-bit word size.
+    // this may change the word length.
     //
     // note that this isn't really very fast: it must read the current word and the write it back.
     // if you have RAM to spare, then you should probably maintain a local screen buffer instead.
@@ -619,8 +2380,10 @@ public:
     //
     // so, for example, if you're targetting 16ms/frame, thats about 26 pixels.
     //
+    // `color` may also be T6A04A_INVERSE.
+    //
     // cost: seven bus operations
-    void write_pixel(u8 x, u8 y, bool on)
+    void write_pixel(u8 x, u8 y, uint16_t color)
     {
         if (x >= X_COUNT || y >= Y_COUNT) {
             return;
@@ -630,271 +2393,400 @@ public:
         u8 column = x / 8;
         u8 bit = x % 8;
 
+        if (this->write_depth > 0) {
+            this->defer_word(row, column, 0b10000000 >> bit, color);
+            return;
+        }
+
+        this->set_word_length(WordLength::WORD_LENGTH_8);
+
         u8 existing = this->read_word_at(row, column);
 
-        u8 next = this->paint_pixel(existing, bit, on);
+        u8 next = this->paint_pixel(existing, bit, color);
 
         if (next != existing) {
             this->write_word_at(row, column, next);
         }
     }
 
-    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    // begin a transaction: until the matching `endWrite`, drawing is recorded
+    // as pending changes to words of display RAM, rather than sent to the panel.
+    // Adafruit_GFX wraps its composite drawing calls (drawRect, drawChar, fillCircle, ...)
+    // in transactions, and transactions may be nested.
+    //
+    // each touched word is then read back (only if partially painted) and written once,
+    // in as few counter-driven runs as possible, when the outermost transaction ends,
+    // or early if more than T6A04A_TRANSACTION_WORDS words are pending.
+    //
+    // raw word access (`read_word`, `write_word`, ...) bypasses the transaction.
+    virtual void startWrite() override
     {
-        if (x < 0 || x >= X_COUNT || y < 0 || y >= Y_COUNT) {
-            return;
-        }
-
-        this->write_pixel(x, y, color != 0);
+        this->write_depth += 1;
     }
 
-    // optimized implementation of horizontal line drawing,
-    // taking advantage of the auto-incrementing counter and
-    // sequential 8-bit read/writes.
-    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+    virtual void endWrite() override
     {
-        if (w == 0) {
-            // zero width line: no pixels.
+        if (this->write_depth == 0) {
             return;
         }
 
-        if (w < 0) {
-            // enforce w to be positive.
-            x = x + w;
-            w = -w;
+        this->write_depth -= 1;
+        if (this->write_depth == 0) {
+            this->flush_pending();
         }
+    }
 
-        if (y < 0 || y >= Y_COUNT) {
-            // this is off the screen, low or high
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        Region r = {};
+        if (!this->clip(x, y, 1, 1, r)) {
             return;
         }
 
-        u8 start_x = x;
-        u8 end_x = x + w;
+        this->write_pixel(r.x0, r.y0, color);
+    }
 
-        if (end_x < 0 || start_x >= X_COUNT) {
-            // all pixels off the side of the screen
+    // optimized implementation of horizontal line drawing.
+    // under rotation 1 or 3, this is a vertical run on the panel,
+    // using the column-wise counter.
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+    {
+        Region r = {};
+        if (!this->clip(x, y, w, 1, r)) {
             return;
         }
 
-        if (start_x < 0) {
-            // clamp line within the screen
-            start_x = 0;
-        }
+        this->fill_region(r, color);
+    }
 
-        if (end_x > X_COUNT) {
-            // clamp line within the screen
-            end_x = X_COUNT;
+    // optimized implementation of vertical line drawing.
+    // under rotation 1 or 3, this is a horizontal run on the panel,
+    // using the row-wise counter.
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+    {
+        Region r = {};
+        if (!this->clip(x, y, 1, h, r)) {
+            return;
         }
 
-        const u8 row = y;
-
-        this->set_word_length(WordLength::WORD_LENGTH_8);
-        this->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
-
-        const u8 start_column = start_x / WordLength::WORD_LENGTH_8;
-        const u8 end_column = end_x / WordLength::WORD_LENGTH_8;
-
-        bool start_aligned = 0 == (start_x % WordLength::WORD_LENGTH_8);
-        bool end_aligned = 0 == (end_x % WordLength::WORD_LENGTH_8);
-
-        // there are two special cases:
-        //  1. only one word is partially overwritten, this takes one read and one write.
-        //  2. the line is word-aligned, we can blindly overwrite those words directly.
-        //
-        // in the general case, we need to read in the existing data,
-        // update it, and write it back out.
-        if (start_column == end_column) {
-            // case 1:
-            // all pixels in the same word
-            // 00xxxxxx00
-
-            u8 left_pixel = start_x % WordLength::WORD_LENGTH_8;
-            u8 right_pixel = end_x % WordLength::WORD_LENGTH_8;
-
-            u8 word = this->read_word_at(row, start_column);
-            for (u8 i = left_pixel; i < right_pixel; i++) {
-                word = this->paint_pixel(word, i, 0 != color);
-            }
-            this->write_word_at(row, start_column, word);
-        } else if (start_aligned && end_aligned) {
-            // case 2:
-            // line with aligned edges
-            // 00000000 xxxxxxxx ... xxxxxxxx 00000000
-            this->set_row(row);
-            this->set_column(start_column);
-            while (x + 8 <= end_x) {
-                // we can blindly overwrite the word
-                // because all bits will be set.
-                if (0 != color) {
-                    this->write_word(0b11111111);
-                } else {
-                    this->write_word(0b00000000);
-                }
-                x += 8;
-            }
-        } else {
-            // general case:
-            // multi-word line with at least one unaligned edge
-            // 00000xxx xxxxxxxx xxx00000
-            // 00000000 xxxxxxxx xxx00000
-            // 00000xxx xxxxxxxx 00000000
-
-            // statically allocate enough space for an entire row (12 bytes),
-            // even if we only use a few bytes,
-            // since this is trivially fast (stack allocation).
-            u8 words[X_COUNT / WordLength::WORD_LENGTH_8];
-
-            // read the start and end words.
-            // we don't care about the middle words,
-            // because we blindly overwrite them.
-            {
-                this->set_row(row);
-
-                this->set_column(start_column);
-                this->read_word(); // dummy
-                words[start_column] = this->read_word();
-
-                if (start_column + 1 != end_column) {
-                    // if the start and end columns are adjacent,
-                    // its faster to just read the next word directly.
-                    // otherwise, seek to end column.
-                    this->set_column(end_column);
-                    this->read_word(); // dummy
-                }
-
-                words[end_column] = this->read_word();
-            }
-
-            // update the row contents
-            // to be written back out in one pass.
-            {
-                // unaligned left side
-                // 00000xxx ........
-                if (0 != start_x % WordLength::WORD_LENGTH_8) {
-                    u8 start_pixel = start_x % WordLength::WORD_LENGTH_8;
-                    u8 start_word = words[start_column];
-
-                    for (u8 i = start_pixel; i < WordLength::WORD_LENGTH_8; i++) {
-                        start_word = this->paint_pixel(start_word, i, 0 != color);
-                        x += 1;
-                    }
+        this->fill_region(r, color);
+    }
 
-                    words[start_column] = start_word;
-                }
-                // x is now aligned to the start of a word.
+    // optimized implementation of line drawing, as used by `drawLine` for diagonal lines.
+    //
+    // this steps through the same pixels as Adafruit_GFX's Bresenham implementation,
+    // but gathers them into runs on the panel, so each touched word is
+    // read and written once per run rather than once per pixel:
+    //  - lines that are steep on the panel gather the pixels of each word column
+    //    into per-row masks, painted in two passes with the column-wise counter.
+    //  - lines that are shallow on the panel gather the pixels of each row
+    //    into a horizontal run, painted with the row-wise counter.
+    // lines near the diagonal also use column runs, since each word column
+    // then spans several rows; see the cost estimates below.
+    //
+    // cost: about 2 bus operations per row for column runs,
+    // and about 8 per row for row runs.
+    virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override
+    {
+        LineRun run;
+        run.empty = true;
+        memset(run.masks, 0, sizeof(run.masks));
+
+        {
+            int16_t px0 = x0;
+            int16_t py0 = y0;
+            int16_t px1 = x1;
+            int16_t py1 = y1;
+            this->map_point(px0, py0);
+            this->map_point(px1, py1);
+
+            const int32_t dx = abs(px1 - px0);
+            const int32_t dy = abs(py1 - py0);
+
+            // column runs: 5 bus operations per word column, plus 2 per row in it.
+            // row runs: about 7 bus operations per row, plus 1 per word in it.
+            const int32_t column_cost = 5 * (dx / WordLength::WORD_LENGTH_8 + 1) + 2 * (dy + dx / WordLength::WORD_LENGTH_8 + 1);
+            const int32_t row_cost = 7 * (dy + 1) + dx / WordLength::WORD_LENGTH_8 + dy + 1;
+            run.column_runs = column_cost <= row_cost;
+        }
 
-                // aligned middle
-                // ........ xxxxxxxx ........
-                while (x + 8 <= end_x) {
-                    // we can blindly overwrite the word
-                    // because all bits will be set.
-                    if (0 != color) {
-                        words[x / WordLength::WORD_LENGTH_8] = 0b11111111;
-                    } else {
-                        words[x / WordLength::WORD_LENGTH_8] = 0b00000000;
-                    }
+        // Bresenham, as in Adafruit_GFX::writeLine.
+        const bool steep = abs(y1 - y0) > abs(x1 - x0);
+        int16_t t;
+        if (steep) {
+            t = x0; x0 = y0; y0 = t;
+            t = x1; x1 = y1; y1 = t;
+        }
 
-                    x += 8;
-                }
+        if (x0 > x1) {
+            t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+        }
 
-                // unaligned right side
-                // ........ xxx00000
-                if (0 != end_x % WordLength::WORD_LENGTH_8) {
-                    u8 end_pixel = end_x % WordLength::WORD_LENGTH_8;
-                    u8 end_word = words[end_column];
+        const int16_t dx = x1 - x0;
+        const int16_t dy = abs(y1 - y0);
+        const int16_t ystep = y0 < y1 ? 1 : -1;
+        int16_t err = dx / 2;
 
-                    for (u8 i = 0; i < end_pixel; i++) {
-                        end_word = this->paint_pixel(end_word, i, 0 != color);
-                        x += 1;
-                    }
+        for (; x0 <= x1; x0++) {
+            int16_t px = steep ? y0 : x0;
+            int16_t py = steep ? x0 : y0;
+            this->map_point(px, py);
 
-                    words[end_column] = end_word;
-                }
+            if (px >= 0 && px < X_COUNT && py >= 0 && py < Y_COUNT) {
+                this->add_line_pixel(run, px, py, color);
             }
 
-            // write the affected row data (up to 12 bytes) in one pass 
-            // relying on the counter to increment the address.
-            {
-                this->set_row(row);
-                this->set_column(start_column);
-                for (u8 i = start_column; i < end_column + 1; i++) {
-                    this->write_word(words[i]);
-                }
+            err -= dy;
+            if (err < 0) {
+                y0 += ystep;
+                err += dx;
             }
         }
+
+        this->flush_line_run(run, color);
     }
 
     virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
     {
-        if (w == 0 || h == 0) {
+        Region r = {};
+        if (!this->clip(x, y, w, h, r)) {
             return;
         }
 
-        if (w < 0) {
-            // enforce w to be positive.
-            x = x + w;
-            w = -w;
+        this->fill_region(r, color);
+    }
+
+    // fill a rectangle with an 8x8 pattern (stipple, hatch, checkerboard),
+    // at the speed of a solid `fillRect`: only the partially covered edge words
+    // of each row are read, and the words between them are written blindly.
+    //
+    // `pattern` is 8 words, one per row, with the MSB leftmost,
+    // and covers pixels both on and off.
+    // it is aligned to the panel's physical pixels, not the rectangle,
+    // so neighbouring fills line up seamlessly, and under rotation
+    // the pattern rotates with the panel.
+    //
+    // cost: about that of `fillRect`
+    void fillRectPattern(int16_t x, int16_t y, int16_t w, int16_t h, const u8 pattern[8])
+    {
+        Region r = {};
+        if (!this->clip(x, y, w, h, r)) {
+            return;
         }
 
-        if (h < 0) {
-            // enforce h to be positive.
-            y = y + h;
-            h = -h;
+        for (u8 row = r.y0; row < r.y1; row++) {
+            this->pattern_span(row, r.x0, r.x1, pattern[row % 8]);
         }
+    }
 
-        if (x >= X_COUNT) {
+    // copy the rectangle [src_x, src_x + w) x [src_y, src_y + h) of the screen
+    // to (dst_x, dst_y), in rotated (logical) coordinates.
+    // the rectangles may overlap: like memmove, each source pixel is read
+    // before it is overwritten. parts of either rectangle that fall off the screen
+    // aren't copied.
+    //
+    // the source is read with sequential reads, shifted by any number of pixels
+    // into the destination's word alignment, and written with sequential writes.
+    // only the destination's partially overwritten edge words are read back.
+    // when the words move by whole words horizontally, and the region is tall,
+    // this copies word columns with the column-wise counter instead of rows.
+    //
+    // this may change the counter config and word length,
+    // and writes out the pending words of a transaction first.
+    //
+    // cost: about 3 bus operations per row and word of the destination
+    void copyRect(int16_t src_x, int16_t src_y, int16_t w, int16_t h, int16_t dst_x, int16_t dst_y)
+    {
+        clip_copy(src_x, dst_x, w, this->_width);
+        clip_copy(src_y, dst_y, h, this->_height);
+        if (w <= 0 || h <= 0 || (src_x == dst_x && src_y == dst_y)) {
             return;
         }
 
-        if (y >= Y_COUNT) {
-            return;
+        Region source = {};
+        Region dest = {};
+        this->clip(src_x, src_y, w, h, source);
+        this->clip(dst_x, dst_y, w, h, dest);
+
+        this->flush_pending();
+
+        if ((dest.x0 - source.x0) % WordLength::WORD_LENGTH_8 == 0) {
+            // compare the costs of copying rows and word columns.
+            const u8 rows = source.y1 - source.y0;
+            const u8 words = (dest.x1 - 1) / WordLength::WORD_LENGTH_8 - dest.x0 / WordLength::WORD_LENGTH_8 + 1;
+            const u16 row_cost = rows * (5 + 2 * words + 6);
+            const u16 column_cost = words * (5 + 2 * rows) + 2 * (3 + rows);
+            if (column_cost < row_cost) {
+                this->copy_columns(source, dest);
+                return;
+            }
         }
 
-        u8 start_x = x;
-        u8 end_x = x + w;
-        u8 start_y = y;
-        u8 end_y = y + h;
+        this->copy_rows(source, dest);
+    }
+
+    // draw a GFXcanvas1 with its top-left pixel at (x, y), straight from its buffer:
+    // set canvas pixels turn panel pixels on, and clear ones turn them off.
+    // the canvas is drawn as stored, ignoring its own rotation.
+    //
+    // the canvas is written with sequential writes, one canvas byte per word
+    // when x is a multiple of 8, or else shifted across two canvas bytes,
+    // row by row, or word column by word column for narrow canvases,
+    // whichever is cheaper.
+    // only the panel's partially covered edge words are read back.
+    //
+    // under rotation, this falls back to Adafruit_GFX's per-pixel `drawBitmap`.
+    //
+    // this may change the counter config and word length,
+    // and writes out the pending words of a transaction first.
+    //
+    // cost: min(rows * (2 + words), words * (2 + rows)) bus operations,
+    // plus reading back the edge words
+    void pushCanvas(const GFXcanvas1 &canvas, int16_t x, int16_t y)
+    {
+        const bool swapped = canvas.getRotation() % 2 == 1;
+        const int16_t w = swapped ? canvas.height() : canvas.width();
+        const int16_t h = swapped ? canvas.width() : canvas.height();
+        uint8_t *buffer = canvas.getBuffer();
 
-        if (end_x < 0) {
+        if (this->rotation != 0) {
+            this->drawBitmap(x, y, buffer, w, h, T6A04A_ON, T6A04A_OFF);
             return;
         }
 
-        if (end_y < 0) {
+        Region r = {};
+        if (w <= 0 || h <= 0 || !this->clip(x, y, w, h, r)) {
             return;
         }
 
-        if (start_x < 0) {
-            // clamp line within the screen
-            start_x = 0;
-        }
+        this->flush_pending();
+        this->set_word_length(WordLength::WORD_LENGTH_8);
 
-        if (end_x > X_COUNT) {
-            // clamp line within the screen
-            end_x = X_COUNT;
-        }
+        const CanvasPush push = {
+            buffer,
+            (u8)((w + WordLength::WORD_LENGTH_8 - 1) / WordLength::WORD_LENGTH_8),
+            x,
+            y,
+        };
 
-        if (start_y < 0) {
-            // clamp line within the screen
-            start_y = 0;
+        const u8 start = r.x0 / WordLength::WORD_LENGTH_8;
+        const u8 end = (r.x1 - 1) / WordLength::WORD_LENGTH_8;
+        const u8 rows = r.y1 - r.y0;
+        const u8 words = end - start + 1;
+        const bool start_partial = r.x0 % WordLength::WORD_LENGTH_8 != 0 || (start == end && r.x1 % WordLength::WORD_LENGTH_8 != 0);
+        const bool end_partial = start != end && r.x1 % WordLength::WORD_LENGTH_8 != 0;
+
+        // compare the costs of writing rows and word columns.
+        const u16 row_cost = rows * (2 + words + (start_partial ? 4 : 0) + (end_partial ? (start_partial && start + 1 == end ? 1 : 4) : 0));
+        const u16 column_cost = words * (2 + rows) + (start_partial + end_partial) * (3 + rows);
+        if (column_cost < row_cost) {
+            this->push_canvas_columns(push, r);
+        } else {
+            this->push_canvas_rows(push, r);
         }
+    }
 
-        if (end_y > Y_COUNT) {
-            // clamp line within the screen
-            end_y = Y_COUNT;
+    // print text, drawing glyphs of a custom GFXfont (see `setFont`)
+    // straight from the font's bitmap, rather than a pixel at a time.
+    // the glyphs of each line of text (up to TEXT_GLYPHS of them) are drawn together,
+    // so neighboring glyphs that share a word column share its read and write pass,
+    // see `draw_glyphs`.
+    // as with Adafruit_GFX, glyphs are drawn transparently, ignoring the background color.
+    //
+    // the built-in font, text sizes other than 1, and rotation fall back to Adafruit_GFX.
+    //
+    // this may change the counter config and word length.
+    //
+    // cost: per word column of a line of glyphs, 5 bus operations plus 2 per row
+    using Adafruit_GFX::write;
+    virtual size_t write(const uint8_t *buffer, size_t size) override
+    {
+        if (this->gfxFont == NULL || this->textsize_x != 1 || this->textsize_y != 1 || this->rotation != 0) {
+            for (size_t i = 0; i < size; i++) {
+                Adafruit_GFX::write(buffer[i]);
+            }
+            return size;
         }
 
-        for (u8 row = start_y; row < end_y; row++) {
-            this->drawFastHLine(start_x, row, end_x - start_x, color);
+        const GFXfont *font = this->gfxFont;
+        const u8 first = pgm_read_byte(&font->first);
+        const u8 last = pgm_read_byte(&font->last);
+        const u8 y_advance = pgm_read_byte(&font->yAdvance);
+        const u8 *bitmap = font_bitmap(font);
+
+        PlacedGlyph glyphs[TEXT_GLYPHS] = {};
+        u8 count = 0;
+
+        for (size_t i = 0; i < size; i++) {
+            const u8 c = buffer[i];
+            if (c == '\n') {
+                this->draw_glyphs(glyphs, count, this->textcolor);
+                count = 0;
+                this->cursor_x = 0;
+                this->cursor_y += y_advance;
+                continue;
+            }
+            if (c == '\r' || c < first || c > last) {
+                continue;
+            }
+
+            const GFXglyph *glyph = font_glyph(font, c - first);
+            const u8 w = pgm_read_byte(&glyph->width);
+            const u8 h = pgm_read_byte(&glyph->height);
+            if (w > 0 && h > 0) {
+                const int8_t xo = pgm_read_byte(&glyph->xOffset);
+                const int8_t yo = pgm_read_byte(&glyph->yOffset);
+                if (this->wrap && this->cursor_x + xo + w > this->_width) {
+                    this->draw_glyphs(glyphs, count, this->textcolor);
+                    count = 0;
+                    this->cursor_x = 0;
+                    this->cursor_y += y_advance;
+                }
+
+                if (count == TEXT_GLYPHS) {
+                    this->draw_glyphs(glyphs, count, this->textcolor);
+                    count = 0;
+                }
+
+                glyphs[count] = PlacedGlyph {
+                    bitmap + pgm_read_word(&glyph->bitmapOffset),
+                    int16_t(this->cursor_x + xo),
+                    int16_t(this->cursor_y + yo),
+                    w,
+                    h,
+                };
+                count += 1;
+            }
+
+            this->cursor_x += (u8)pgm_read_byte(&glyph->xAdvance);
         }
+
+        this->draw_glyphs(glyphs, count, this->textcolor);
+        return size;
+    }
+
+    virtual size_t write(uint8_t c) override
+    {
+        return this->write(&c, 1);
     }
 
+    // this covers the whole panel, whatever the rotation.
     virtual void fillScreen(uint16_t color) override
     {
-        this->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
-        this->set_word_length(WordLength::WORD_LENGTH_8);
+        if (T6A04A_INVERSE == color) {
+            // cost: 1596 bus operations
+            for (u8 x = 0; x < (X_COUNT / WordLength::WORD_LENGTH_8); x++) {
+                this->column_span(x, 0, Y_COUNT, NULL, 0b11111111, color);
+            }
+            return;
+        }
 
         const u8 word = 0 == color ? 0b00000000 : 0b11111111;
+        this->begin_fill(word);
+
+        this->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+        this->set_word_length(WordLength::WORD_LENGTH_8);
 
         // columns are longer than rows,
         // so clear column-wise for fewer total calls to set_row/column
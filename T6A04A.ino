@@ -1,5 +1,14 @@
 #include "T6A04A.h"
 
+// define this to drive the data lines through shift registers on SPI,
+// see shift.h, for example to compare the benchmarks of the two buses.
+// #define LCD_SHIFT_BUS
+
+// define this to run the driver's tests over serial before the benchmarks, see test.h:
+// the feature checks, and the differential fuzz test of the drawing routines,
+// which takes a few minutes.
+// #define LCD_TEST
+
 // arduino uno r3 pinout
 // via: https://www.circuito.io/blog/arduino-uno-pinout/
 #define D0 (0)
@@ -26,6 +35,31 @@
 // my personal pinout on an Arduino Uno R3
 #define LCD_RST D14  // D0 is serial IO pin, D13 is LED_BUILTIN
 #define LCD_STB D15
+
+#ifdef LCD_SHIFT_BUS
+
+#include "shift.h"
+
+// D11-D13 are taken by SPI.
+#define LCD_DI D2
+#define LCD_CE D3
+#define LCD_RW D4
+#define LCD_LATCH D5
+#define LCD_OE D6
+#define LCD_LOAD D7
+
+static T6A04AShiftBus bus(
+    LCD_DI,
+    LCD_RW,
+    LCD_LATCH,
+    LCD_OE,
+    LCD_LOAD
+);
+
+static T6A04A lcd(&bus, LCD_RST, LCD_STB, LCD_CE);
+
+#else
+
 #define LCD_DI D2
 #define LCD_CE D3
 #define LCD_D7 D4
@@ -54,11 +88,30 @@ static T6A04A lcd(
     LCD_RW
 );
 
+#endif // LCD_SHIFT_BUS
+
+#include "calib.h"
 #include "opt.h"
 
+#ifdef LCD_TEST
+#include "test.h"
+#endif
+
+// the delays measured for this panel, kept at the start of EEPROM.
+static T6A04ACalibration calibration(&lcd, 0);
+
 void setup()
 {
     Serial.begin(9600);
+
+    lcd.init();
+    calibration.begin();
+
+#ifdef LCD_TEST
+    test_T6A04A(&lcd);
+    fuzz_T6A04A(&lcd, 500, 1);
+#endif
+
     run_benchmarks(&lcd);
 
     lcd.init();
@@ -0,0 +1,232 @@
+#ifndef BAND_H
+#define BAND_H
+
+#include "T6A04A.h"
+
+// draws a whole frame onto the given surface.
+// called once per band, so it must draw the same frame each time.
+typedef void (*Redraw)(Adafruit_GFX *gfx);
+
+//
+// render a frame in horizontal bands of rows, for boards without RAM
+// for a full 768 byte frame buffer, but where reading back from the panel is too slow.
+//
+// the redraw callback draws the whole frame onto this surface once per band,
+// and only the pixels falling in the current band are kept in the band buffer.
+// each finished band is streamed to the panel with sequential writes,
+// so every word is written exactly once, and nothing is read back.
+//
+// taller bands cost more RAM (12 bytes per row) but fewer redraws:
+//
+//   band rows | RAM       | redraws per frame
+//   ----------+-----------+------------------
+//           8 |  96 bytes | 8
+//          16 | 192 bytes | 4
+//          64 | 768 bytes | 1
+//
+// see the banded render benchmarks in opt.cpp for the resulting frame times.
+//
+class T6A04ABand : public Adafruit_GFX
+{
+private:
+    static const u8 WORDS_PER_ROW = X_COUNT / WordLength::WORD_LENGTH_8;
+
+    T6A04A *lcd;
+
+    // [row][word] for the rows of the current band.
+    u8 *band;
+    u8 band_rows;
+
+    // the physical rows of the current band, [band_top, band_bottom).
+    u8 band_top;
+    u8 band_bottom;
+
+    // send the current band to the panel,
+    // column by column or row by row, whichever takes fewer address changes.
+    //
+    // cost: 12 * rows + min(2 * rows, 24) bus operations
+    void flush_band()
+    {
+        const u8 rows = this->band_bottom - this->band_top;
+
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+
+        if (rows > WORDS_PER_ROW) {
+            this->lcd->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+            for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+                this->lcd->set_row(this->band_top);
+                this->lcd->set_column(column);
+                for (u8 row = 0; row < rows; row++) {
+                    this->lcd->write_word(this->band[row * WORDS_PER_ROW + column]);
+                }
+            }
+        } else {
+            this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+            for (u8 row = 0; row < rows; row++) {
+                this->lcd->set_row(this->band_top + row);
+                this->lcd->set_column(0);
+                for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+                    this->lcd->write_word(this->band[row * WORDS_PER_ROW + column]);
+                }
+            }
+        }
+    }
+
+public:
+    // `buffer` must hold 12 * `band_rows` bytes.
+    T6A04ABand(T6A04A *lcd, u8 *buffer, u8 band_rows)
+        : Adafruit_GFX(X_COUNT, Y_COUNT),
+          lcd(lcd),
+          band(buffer),
+          band_rows(band_rows),
+          band_top(0),
+          band_bottom(0)
+    {}
+
+    // render a full frame, calling `redraw` once per band.
+    //
+    // this may change the counter config and word length.
+    //
+    // cost: 768 bus operations, plus address changes (see `flush_band`)
+    void render(Redraw redraw)
+    {
+        for (u8 top = 0; top < Y_COUNT; top += this->band_rows) {
+            this->band_top = top;
+            this->band_bottom = top + this->band_rows > Y_COUNT ? Y_COUNT : top + this->band_rows;
+
+            memset(this->band, 0, this->band_rows * WORDS_PER_ROW);
+            redraw(this);
+
+            this->flush_band();
+        }
+    }
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (x < 0 || x >= this->_width || y < 0 || y >= this->_height) {
+            return;
+        }
+
+        int16_t t;
+        switch (this->rotation) {
+        case 1:
+            t = x;
+            x = this->WIDTH - 1 - y;
+            y = t;
+            break;
+        case 2:
+            x = this->WIDTH - 1 - x;
+            y = this->HEIGHT - 1 - y;
+            break;
+        case 3:
+            t = x;
+            x = y;
+            y = this->HEIGHT - 1 - t;
+            break;
+        }
+
+        if (y < this->band_top || y >= this->band_bottom) {
+            return;
+        }
+
+        u8 *word = &this->band[(y - this->band_top) * WORDS_PER_ROW + x / WordLength::WORD_LENGTH_8];
+        const u8 bit = 0b10000000 >> (x % WordLength::WORD_LENGTH_8);
+        if (T6A04A_INVERSE == color) {
+            *word ^= bit;
+        } else if (0 != color) {
+            *word |= bit;
+        } else {
+            *word &= ~bit;
+        }
+    }
+
+    // fill only the rows of the rectangle that fall in the current band,
+    // a byte at a time.
+    // under rotation, this falls back to Adafruit_GFX's per-pixel implementation.
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+    {
+        if (this->rotation != 0) {
+            Adafruit_GFX::fillRect(x, y, w, h, color);
+            return;
+        }
+
+        if (w < 0) {
+            x = x + w;
+            w = -w;
+        }
+
+        if (h < 0) {
+            y = y + h;
+            h = -h;
+        }
+
+        const int16_t x0 = x < 0 ? 0 : x;
+        const int16_t x1 = x + w > X_COUNT ? X_COUNT : x + w;
+        const int16_t y0 = y < this->band_top ? this->band_top : y;
+        const int16_t y1 = y + h > this->band_bottom ? this->band_bottom : y + h;
+
+        if (x0 >= x1 || y0 >= y1) {
+            return;
+        }
+
+        for (int16_t row = y0; row < y1; row++) {
+            u8 *words = &this->band[(row - this->band_top) * WORDS_PER_ROW];
+            for (int16_t i = x0; i < x1; ) {
+                const u8 bit = i % WordLength::WORD_LENGTH_8;
+                u8 *word = &words[i / WordLength::WORD_LENGTH_8];
+
+                if (bit == 0 && i + WordLength::WORD_LENGTH_8 <= x1) {
+                    if (T6A04A_INVERSE == color) {
+                        *word ^= 0b11111111;
+                    } else {
+                        *word = 0 != color ? 0b11111111 : 0b00000000;
+                    }
+                    i += WordLength::WORD_LENGTH_8;
+                } else {
+                    if (T6A04A_INVERSE == color) {
+                        *word ^= 0b10000000 >> bit;
+                    } else if (0 != color) {
+                        *word |= 0b10000000 >> bit;
+                    } else {
+                        *word &= ~(0b10000000 >> bit);
+                    }
+                    i += 1;
+                }
+            }
+        }
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+    {
+        if (this->rotation != 0) {
+            Adafruit_GFX::drawFastHLine(x, y, w, color);
+            return;
+        }
+
+        this->fillRect(x, y, w, 1, color);
+    }
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+    {
+        if (this->rotation != 0) {
+            Adafruit_GFX::drawFastVLine(x, y, h, color);
+            return;
+        }
+
+        this->fillRect(x, y, 1, h, color);
+    }
+
+    virtual void fillScreen(uint16_t color) override
+    {
+        if (T6A04A_INVERSE == color) {
+            for (u16 i = 0; i < this->band_rows * WORDS_PER_ROW; i++) {
+                this->band[i] ^= 0b11111111;
+            }
+            return;
+        }
+
+        memset(this->band, 0 != color ? 0b11111111 : 0b00000000, this->band_rows * WORDS_PER_ROW);
+    }
+};
+
+#endif // BAND_H
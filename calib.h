@@ -0,0 +1,305 @@
+#ifndef CALIB_H
+#define CALIB_H
+
+#include <EEPROM.h>
+
+#include "T6A04A.h"
+
+//
+// measure the shortest delays a panel and its wiring reliably work with,
+// and keep them in EEPROM, so the driver doesn't spend the datasheet-derived
+// 10us around every strobe (see `T6A04A::set_timing`).
+//
+// `calibrate` writes patterns to a few rows, reads them back,
+// and binary searches each delay on its own, the instruction writes, the data writes
+// and the reads, while the other two stay at the default.
+// a delay is accepted when several rounds of patterns read back intact,
+// and then lengthened by a safety margin, since the panel gets slower
+// as it gets colder or its supply drops.
+//
+// calibrating overwrites the display RAM, and leaves the panel cleared.
+// it takes a few hundred milliseconds, so keep its result with `save`,
+// and call `calibrate` again after changing the wiring or the panel.
+//
+// example:
+//
+//   static T6A04ACalibration calibration(&lcd, 0);
+//
+//   void setup() {
+//       lcd.init();
+//       calibration.begin();
+//       ...
+//   }
+//
+class T6A04ACalibration
+{
+private:
+    // marks a valid record in EEPROM.
+    static const u8 MAGIC = 0x6A;
+
+    // rounds of patterns a delay must pass.
+    static const u8 ROUNDS = 4;
+
+    // the rows written by each round, spread over the panel.
+    static const u8 ROWS = 4;
+
+    static const u8 WORDS_PER_ROW = X_COUNT / WordLength::WORD_LENGTH_8;
+
+    typedef enum Delay {
+        INSTRUCTION = 1,
+        DATA = 2,
+        READ = 3,
+    } Delay;
+
+    typedef struct Record {
+        u8 magic;
+        Timing timing;
+        u8 check;
+    } Record;
+
+    T6A04A *lcd;
+    int address;
+
+    static u8 record_check(const Record &r)
+    {
+        return ~(r.magic + r.timing.instruction_us + r.timing.data_us + r.timing.read_us);
+    }
+
+    static u8 get_delay(const Timing &t, Delay d)
+    {
+        if (d == Delay::INSTRUCTION) {
+            return t.instruction_us;
+        } else if (d == Delay::DATA) {
+            return t.data_us;
+        } else {
+            return t.read_us;
+        }
+    }
+
+    static void set_delay(Timing &t, Delay d, u8 us)
+    {
+        if (d == Delay::INSTRUCTION) {
+            t.instruction_us = us;
+        } else if (d == Delay::DATA) {
+            t.data_us = us;
+        } else {
+            t.read_us = us;
+        }
+    }
+
+    // a word that differs between neighboring words, rows and rounds,
+    // so a word written to, or read from, the wrong address doesn't match.
+    static u8 pattern(u8 round, u8 row, u8 column)
+    {
+        return (row * 37 + column * 11 + round * 73) ^ 0b10100101;
+    }
+
+    // write a round of patterns and read them back, at the current timing.
+    //
+    // cost: 116 bus operations
+    bool check_round(u8 round)
+    {
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        for (u8 i = 0; i < ROWS; i++) {
+            const u8 row = i * (Y_COUNT / ROWS) + round;
+            this->lcd->set_row(row);
+            this->lcd->set_column(0);
+            for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+                this->lcd->write_word(pattern(round, row, column));
+            }
+        }
+
+        bool ok = true;
+        for (u8 i = 0; i < ROWS; i++) {
+            const u8 row = i * (Y_COUNT / ROWS) + round;
+            this->lcd->set_row(row);
+            this->lcd->set_column(0);
+            this->lcd->read_word(); // dummy
+            for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+                if (this->lcd->read_word() != pattern(round, row, column)) {
+                    ok = false;
+                }
+            }
+        }
+
+        return ok;
+    }
+
+    // whether every round of patterns survives the given timing.
+    // a failed round may have garbled any register,
+    // so the panel is re-initialized at the default timing before each round.
+    bool check(Timing t)
+    {
+        for (u8 round = 0; round < ROUNDS; round++) {
+            this->lcd->set_timing(T6A04A::default_timing());
+            this->lcd->init();
+
+            this->lcd->set_timing(t);
+            if (!this->check_round(round)) {
+                this->lcd->set_timing(T6A04A::default_timing());
+                return false;
+            }
+        }
+
+        this->lcd->set_timing(T6A04A::default_timing());
+        return true;
+    }
+
+    // the k-th candidate delay of the given kind: the shortest,
+    // lengthened by k steps of the delay's resolution, up to the default.
+    static u8 candidate(Delay d, u8 k)
+    {
+        const u16 us = get_delay(T6A04A::min_timing(), d) + k * get_delay(T6A04A::timing_resolution(), d);
+        const u8 max_us = get_delay(T6A04A::default_timing(), d);
+        return us < max_us ? us : max_us;
+    }
+
+    // the shortest delay of the given kind that passes `check`,
+    // assuming the default passes.
+    //
+    // only delays a resolution step apart are searched: the driver can't tell
+    // apart the write delays between them, see `T6A04A::timing_resolution`.
+    u8 search(Delay d)
+    {
+        Timing t = T6A04A::default_timing();
+
+        u8 low = 0;
+        u8 high = 0;
+        while (candidate(d, high) < get_delay(t, d)) {
+            high += 1;
+        }
+
+        while (low < high) {
+            const u8 mid = (low + high) / 2;
+            set_delay(t, d, candidate(d, mid));
+            if (this->check(t)) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+
+        return candidate(d, high);
+    }
+
+    // half again, but at least a resolution step more, and never more than the default.
+    static u8 with_margin(Delay d, u8 us)
+    {
+        const u8 step = get_delay(T6A04A::timing_resolution(), d);
+        const u8 max_us = get_delay(T6A04A::default_timing(), d);
+        const u16 padded = us + (us / 2 > step ? us / 2 : step);
+        return padded < max_us ? padded : max_us;
+    }
+
+    u32 measure_clear()
+    {
+        const u32 ts0 = micros();
+        this->lcd->clear();
+        return micros() - ts0;
+    }
+
+public:
+    // keep the calibration in EEPROM at `address`, which takes 5 bytes.
+    T6A04ACalibration(T6A04A *lcd, int address)
+        : lcd(lcd),
+          address(address)
+    {
+    }
+
+    // use the calibration kept in EEPROM, or calibrate and keep the result.
+    void begin()
+    {
+        if (!this->load() && this->calibrate()) {
+            this->save();
+        }
+    }
+
+    // use the calibration kept in EEPROM.
+    //
+    // returns false, leaving the timing as it was, if there is none.
+    bool load()
+    {
+        Record r;
+        EEPROM.get(this->address, r);
+
+        const Timing max = T6A04A::default_timing();
+        if (r.magic != MAGIC
+                || r.check != record_check(r)
+                || r.timing.instruction_us > max.instruction_us
+                || r.timing.data_us > max.data_us
+                || r.timing.read_us > max.read_us) {
+            return false;
+        }
+
+        this->lcd->set_timing(r.timing);
+        return true;
+    }
+
+    // keep the panel's current timing in EEPROM.
+    // unchanged bytes aren't rewritten, to spare the EEPROM.
+    void save()
+    {
+        Record r;
+        r.magic = MAGIC;
+        r.timing = this->lcd->current_timing();
+        r.check = record_check(r);
+        EEPROM.put(this->address, r);
+    }
+
+    // drop the calibration kept in EEPROM, so `begin` calibrates again.
+    void forget()
+    {
+        EEPROM.update(this->address, ~MAGIC);
+    }
+
+    // find the shortest reliable delays for this panel, add the safety margin,
+    // and use them from now on. logs the delays, and how much faster a clear got.
+    //
+    // returns false, leaving the default timing, if the panel doesn't
+    // read back its patterns even at the default timing, such as when it's miswired.
+    //
+    // this may change the counter config and word length, and clears the panel.
+    bool calibrate()
+    {
+        const Timing defaults = T6A04A::default_timing();
+
+        this->lcd->set_timing(defaults);
+        if (!this->check(defaults)) {
+            Serial.println(F("error: the panel doesn't read back at the default timing"));
+            this->lcd->init();
+            return false;
+        }
+
+        this->lcd->init();
+        const u32 before_us = this->measure_clear();
+
+        Timing t;
+        t.instruction_us = with_margin(Delay::INSTRUCTION, this->search(Delay::INSTRUCTION));
+        t.data_us = with_margin(Delay::DATA, this->search(Delay::DATA));
+        t.read_us = with_margin(Delay::READ, this->search(Delay::READ));
+
+        this->lcd->init();
+        this->lcd->set_timing(t);
+        const u32 after_us = this->measure_clear();
+
+        Serial.print(F("calibration: instruction "));
+        Serial.print(t.instruction_us);
+        Serial.print(F("us, data "));
+        Serial.print(t.data_us);
+        Serial.print(F("us, read "));
+        Serial.print(t.read_us);
+        Serial.print(F("us; clear "));
+        Serial.print(before_us);
+        Serial.print(F("us -> "));
+        Serial.print(after_us);
+        Serial.print(F("us ("));
+        Serial.print(float(before_us) / float(after_us));
+        Serial.println(F("x)"));
+
+        return true;
+    }
+};
+
+#endif // CALIB_H
@@ -0,0 +1,265 @@
+#ifndef CHART_H
+#define CHART_H
+
+#include "T6A04A.h"
+
+typedef enum ChartMode {
+    // time runs left to right through the plot area, and a cursor sweeps across it,
+    // overwriting the oldest sample, like an oscilloscope.
+    // a blank column just ahead of the cursor marks where the trace is being drawn.
+    SWEEP = 1,
+    // time runs down the whole panel, and each sample is a new row at the bottom,
+    // scrolled into view with the Z-address instead of moving any pixels.
+    // this scrolls everything else on the panel too, so the chart should own it.
+    SCROLL = 2,
+} ChartMode;
+
+//
+// a strip chart of sensor samples, updated in a few bus operations per sample,
+// for plotting hundreds of samples per second.
+//
+// the plot area is `words` word columns wide, starting at word column `column`,
+// and `height` rows tall, starting at row `top`, in physical coordinates.
+// each sample is drawn as a line from the previous sample, within one pixel column
+// (or one row, when scrolling), so the trace stays continuous.
+//
+// the chart owns its plot area: it keeps the trace segment of each of the
+// last 8 * `words` samples, and composes each word from them,
+// so words are written blindly and nothing is read back.
+//
+// when sweeping, a sample rewrites only the rows its word column changed in,
+// with the column-wise counter: 2 + rows bus operations, or 3 for a flat trace.
+// when scrolling, a sample writes a row of the plot area: 3 + words bus operations.
+//
+// example:
+//
+//   static T6A04AChart chart(&lcd, 0, 12, 0, Y_COUNT, 0, 1023);
+//
+//   chart.push_sample(analogRead(A0));
+//
+class T6A04AChart
+{
+private:
+    // marks a pixel column without a trace segment, with `high` below `low`.
+    static const u8 EMPTY = 0xFF;
+
+    T6A04A *lcd;
+
+    ChartMode mode;
+    u8 column;
+    u8 words;
+    u8 top;
+    u8 height;
+    int16_t min;
+    int16_t max;
+
+    // the trace segment of each pixel column while sweeping,
+    // the rows [low, high] relative to `top`.
+    u8 low[X_COUNT];
+    u8 high[X_COUNT];
+
+    // the pixel column of the next sample while sweeping, relative to the plot area.
+    u8 cursor;
+
+    // the position of the previous sample within the plot, or EMPTY before the first.
+    u8 last;
+
+    // the Z-address while scrolling.
+    u8 z;
+
+    u8 width() const
+    {
+        return this->words * WordLength::WORD_LENGTH_8;
+    }
+
+    // map a sample onto [0, span), with `max` at 0 when `flip` is set.
+    u8 scale(int16_t value, u8 span, bool flip) const
+    {
+        if (value < this->min) {
+            value = this->min;
+        }
+
+        if (value > this->max) {
+            value = this->max;
+        }
+
+        const u8 at = ((int32_t)value - this->min) * (span - 1) / ((int32_t)this->max - this->min);
+        return flip ? span - 1 - at : at;
+    }
+
+    // the word of the plot at word column `word` and row `row`, from the trace segments.
+    u8 compose(u8 word, u8 row) const
+    {
+        u8 result = 0;
+        for (u8 i = 0; i < WordLength::WORD_LENGTH_8; i++) {
+            const u8 x = word * WordLength::WORD_LENGTH_8 + i;
+            if (this->low[x] <= row && row <= this->high[x]) {
+                result |= 0b10000000 >> i;
+            }
+        }
+        return result;
+    }
+
+    // rewrite the rows [start, end] of a word column of the plot.
+    //
+    // cost: 3 + end - start bus operations
+    void write_column(u8 word, u8 start, u8 end)
+    {
+        this->lcd->set_row(this->top + start);
+        this->lcd->set_column(this->column + word);
+        for (u8 row = start; row <= end; row++) {
+            this->lcd->write_word(this->compose(word, row));
+        }
+    }
+
+    // cost: 2 + rows rewritten bus operations, for each word column rewritten
+    void push_sweep(int16_t value)
+    {
+        const u8 y = this->scale(value, this->height, true);
+        const u8 x = this->cursor;
+        const u8 next = x + 1 == this->width() ? 0 : x + 1;
+
+        // the rows to rewrite in each word column: the old and new segments at the cursor,
+        // and the old segment of the gap column, which is erased.
+        u8 start = this->low[x];
+        u8 end = this->high[x];
+        u8 gap_start = this->low[next];
+        u8 gap_end = this->high[next];
+
+        this->low[x] = this->last == EMPTY || y < this->last ? y : this->last;
+        this->high[x] = this->last == EMPTY || y > this->last ? y : this->last;
+        this->low[next] = EMPTY;
+        this->high[next] = 0;
+        this->last = y;
+        this->cursor = next;
+
+        start = start < this->low[x] ? start : this->low[x];
+        end = end > this->high[x] ? end : this->high[x];
+
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+
+        if (next / WordLength::WORD_LENGTH_8 == x / WordLength::WORD_LENGTH_8) {
+            if (gap_start != EMPTY) {
+                start = start < gap_start ? start : gap_start;
+                end = end > gap_end ? end : gap_end;
+            }
+        } else if (gap_start != EMPTY) {
+            this->write_column(next / WordLength::WORD_LENGTH_8, gap_start, gap_end);
+        }
+
+        this->write_column(x / WordLength::WORD_LENGTH_8, start, end);
+    }
+
+    // cost: 3 + words bus operations
+    void push_scroll(int16_t value)
+    {
+        const u8 x = this->scale(value, this->width(), false);
+        const u8 start = this->last == EMPTY || x < this->last ? x : this->last;
+        const u8 end = this->last == EMPTY || x > this->last ? x : this->last;
+        this->last = x;
+
+        // the top row scrolls off, and comes back as the new bottom row.
+        // the row is written before Z moves, so it never shows up at the bottom stale.
+        const u8 row = this->z;
+
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+        this->lcd->set_row(row);
+        this->lcd->set_column(this->column);
+        for (u8 word = 0; word < this->words; word++) {
+            const u8 left = word * WordLength::WORD_LENGTH_8;
+            u8 bits = 0;
+            for (u8 i = 0; i < WordLength::WORD_LENGTH_8; i++) {
+                if (start <= left + i && left + i <= end) {
+                    bits |= 0b10000000 >> i;
+                }
+            }
+            this->lcd->write_word(bits);
+        }
+
+        this->z = (this->z + 1) % Y_COUNT;
+        this->lcd->set_z(this->z);
+    }
+
+public:
+    // plot samples in [min, max] in the given plot area, see above.
+    // the chart assumes its plot area is blank on the panel, see `clear`.
+    T6A04AChart(T6A04A *lcd, u8 column, u8 words, u8 top, u8 height, int16_t min, int16_t max)
+        : lcd(lcd),
+          mode(ChartMode::SWEEP),
+          column(column),
+          words(words),
+          top(top),
+          height(height),
+          min(min),
+          max(max),
+          z(0)
+    {
+        if (words == 0 || column + words > X_COUNT / WordLength::WORD_LENGTH_8 || height < 2 || top + height > Y_COUNT || min >= max) {
+            Serial.println(F("error: invalid chart area or range"));
+            abort();
+        }
+
+        this->forget();
+    }
+
+    // switch between sweeping and scrolling, clearing the chart.
+    //
+    // scrolling ignores `top` and `height`, and uses the whole panel's height.
+    void set_mode(ChartMode mode)
+    {
+        this->mode = mode;
+        this->clear();
+    }
+
+    // blank the plot area and forget every sample.
+    // when scrolling, the Z-address is reset, so this blanks the whole height of the panel.
+    //
+    // cost: 1 + words * (2 + rows) bus operations
+    void clear()
+    {
+        this->forget();
+
+        const u8 top = this->mode == ChartMode::SCROLL ? 0 : this->top;
+        const u8 rows = this->mode == ChartMode::SCROLL ? Y_COUNT : this->height;
+
+        this->z = 0;
+        this->lcd->set_z(0);
+
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+        for (u8 word = 0; word < this->words; word++) {
+            this->lcd->set_row(top);
+            this->lcd->set_column(this->column + word);
+            for (u8 row = 0; row < rows; row++) {
+                this->lcd->write_word(0b00000000);
+            }
+        }
+    }
+
+    // forget every sample, without touching the panel.
+    void forget()
+    {
+        memset(this->low, EMPTY, sizeof(this->low));
+        memset(this->high, 0, sizeof(this->high));
+        this->cursor = 0;
+        this->last = EMPTY;
+    }
+
+    // plot the next sample.
+    //
+    // this may change the counter config and word length.
+    //
+    // cost: 2 + rows changed bus operations when sweeping, 3 + words when scrolling
+    void push_sample(int16_t value)
+    {
+        if (this->mode == ChartMode::SWEEP) {
+            this->push_sweep(value);
+        } else {
+            this->push_scroll(value);
+        }
+    }
+};
+
+#endif // CHART_H
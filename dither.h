@@ -0,0 +1,196 @@
+#ifndef DITHER_H
+#define DITHER_H
+
+#include "T6A04A.h"
+
+typedef enum DitherMode {
+    // threshold against an 8x8 Bayer matrix, aligned to the screen.
+    // stateless, so rows may also be redrawn out of order.
+    BAYER = 1,
+    // diffuse each pixel's error onto its neighbours.
+    // smoother, but needs a row of error terms.
+    FLOYD_STEINBERG = 2,
+} DitherMode;
+
+//
+// dither 8-bit grayscale rows (0 is black, 255 is white) down to the panel,
+// one row at a time, for images too large to hold in RAM,
+// such as camera frames or sensor heatmaps.
+//
+// each pushed row is dithered, packed into words as it goes,
+// and written with sequential writes, so it costs 2 + width / 8 bus operations,
+// and the dithering of each word overlaps with the settle time of the previous write.
+//
+// Floyd-Steinberg keeps only one row of error terms, supplied by the caller:
+// `width` int16_t values, or 2 * width bytes. Bayer needs none.
+//
+// the image is placed at a word column, and rows are written as whole words,
+// so a width that isn't a multiple of 8 also clears the rest of the last word.
+//
+// example, a full screen:
+//
+//   static int16_t errors[X_COUNT];
+//   static T6A04ADither dither(&lcd, errors, X_COUNT, Y_COUNT);
+//
+//   for (u8 y = 0; y < Y_COUNT; y++) {
+//       camera.read_row(row);
+//       dither.push_row(row);
+//   }
+//
+class T6A04ADither
+{
+private:
+    T6A04A *lcd;
+    int16_t *errors;
+
+    DitherMode mode;
+    u8 width;
+    u8 height;
+    u8 column;
+    u8 top;
+
+    // the next row to push, relative to `top`.
+    u8 row;
+
+    // 8x8 Bayer matrix, values [0, 64).
+    static u8 bayer(u8 x, u8 y)
+    {
+        static const u8 matrix[8][8] PROGMEM = {
+            {  0, 32,  8, 40,  2, 34, 10, 42 },
+            { 48, 16, 56, 24, 50, 18, 58, 26 },
+            { 12, 44,  4, 36, 14, 46,  6, 38 },
+            { 60, 28, 52, 20, 62, 30, 54, 22 },
+            {  3, 35, 11, 43,  1, 33,  9, 41 },
+            { 51, 19, 59, 27, 49, 17, 57, 25 },
+            { 15, 47,  7, 39, 13, 45,  5, 37 },
+            { 63, 31, 55, 23, 61, 29, 53, 21 },
+        };
+        return pgm_read_byte(&matrix[y % 8][x % 8]);
+    }
+
+    // cost: 2 + words bus operations
+    void push_bayer(const u8 *gray)
+    {
+        const u8 y = this->top + this->row;
+        const u8 x0 = this->column * WordLength::WORD_LENGTH_8;
+
+        u8 word = 0;
+        for (u8 x = 0; x < this->width; x++) {
+            // a pixel darker than its threshold is turned on.
+            if (gray[x] < bayer(x0 + x, y) * 4 + 2) {
+                word |= 0b10000000 >> (x % WordLength::WORD_LENGTH_8);
+            }
+
+            if (x % WordLength::WORD_LENGTH_8 == WordLength::WORD_LENGTH_8 - 1 || x == this->width - 1) {
+                this->lcd->write_word(word);
+                word = 0;
+            }
+        }
+    }
+
+    // the error of each pixel goes 7/16 to the right, and 3/16, 5/16 and 1/16
+    // to the pixels below left, below and below right.
+    // `errors[x]` holds the error carried into pixel x of the current row,
+    // and is replaced by the error for the next row once pixel x + 1 is done.
+    //
+    // cost: 2 + words bus operations
+    void push_floyd_steinberg(const u8 *gray)
+    {
+        int16_t right = 0;
+        // the next row's errors for pixels x - 1 and x, so far.
+        int16_t below_left = 0;
+        int16_t below = 0;
+
+        u8 word = 0;
+        for (u8 x = 0; x < this->width; x++) {
+            const int16_t v = gray[x] + this->errors[x] + right;
+            const bool on = v < 128;
+            const int16_t error = v - (on ? 0 : 255);
+
+            if (on) {
+                word |= 0b10000000 >> (x % WordLength::WORD_LENGTH_8);
+            }
+
+            right = error * 7 / 16;
+            if (x > 0) {
+                this->errors[x - 1] = below_left + error * 3 / 16;
+            }
+            below_left = below + error * 5 / 16;
+            below = error / 16;
+
+            if (x % WordLength::WORD_LENGTH_8 == WordLength::WORD_LENGTH_8 - 1 || x == this->width - 1) {
+                this->lcd->write_word(word);
+                word = 0;
+            }
+        }
+
+        this->errors[this->width - 1] = below_left;
+    }
+
+public:
+    // dither into the `width` x `height` pixels at word column `column` and row `top`.
+    // `errors` may be NULL when only using `BAYER`.
+    T6A04ADither(T6A04A *lcd, int16_t *errors, u8 width, u8 height, u8 column = 0, u8 top = 0)
+        : lcd(lcd),
+          errors(errors),
+          mode(errors == NULL ? DitherMode::BAYER : DitherMode::FLOYD_STEINBERG),
+          width(width),
+          height(height),
+          column(column),
+          top(top),
+          row(0)
+    {
+        this->begin_frame();
+    }
+
+    void set_mode(DitherMode mode)
+    {
+        if (mode == DitherMode::FLOYD_STEINBERG && this->errors == NULL) {
+            Serial.println(F("error: Floyd-Steinberg needs an error buffer"));
+            abort();
+        }
+
+        this->mode = mode;
+        this->begin_frame();
+    }
+
+    // start again from the top row, forgetting any diffused error.
+    // this happens automatically after the last row of a frame.
+    void begin_frame()
+    {
+        this->row = 0;
+        if (this->errors != NULL) {
+            memset(this->errors, 0, this->width * sizeof(int16_t));
+        }
+    }
+
+    // dither and write the next row of `width` grayscale pixels.
+    //
+    // this may change the counter config and word length.
+    //
+    // cost: 2 + ceil(width / 8) bus operations, none for an empty area
+    void push_row(const u8 *gray)
+    {
+        if (this->width == 0 || this->height == 0) {
+            return;
+        }
+
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+        this->lcd->set_row(this->top + this->row);
+        this->lcd->set_column(this->column);
+
+        if (this->mode == DitherMode::BAYER) {
+            this->push_bayer(gray);
+        } else {
+            this->push_floyd_steinberg(gray);
+        }
+
+        this->row += 1;
+        if (this->row == this->height) {
+            this->begin_frame();
+        }
+    }
+};
+
+#endif // DITHER_H
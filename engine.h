@@ -0,0 +1,237 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "T6A04A.h"
+
+// the number of writes the engine can hold, a power of two up to 128.
+// each costs two bytes of RAM.
+#ifndef T6A04A_ENGINE_WRITES
+#define T6A04A_ENGINE_WRITES 64
+#endif
+
+//
+// strobe a panel's writes from a timer interrupt, one per tick,
+// so drawing from `loop()` only pays for queueing them,
+// not for the strobes and the settle time between them.
+//
+// drawing calls push each write (an instruction, such as an address, or a data word)
+// into a lock-free ring, and the interrupt drains it by calling `service`.
+// only `loop()` pushes and only the interrupt drains,
+// so neither needs to disable interrupts.
+// when the ring is full, pushing waits for the interrupt to make room.
+//
+// reads can't be queued: a read (including the read-backs of unaligned drawing)
+// first waits for the ring to drain. draw with whole words, such as aligned
+// rects and `pushCanvas`, to keep the ring busy.
+//
+// the tick should be a little longer than strobing one write takes from the interrupt,
+// plus the settle time, see `T6A04A::set_timing`: any shorter, and the interrupt
+// waits out the settle time instead of `loop()`.
+//
+// the engine drives the bus from the interrupt, so no other panel on it can be
+// drawn on while the engine is attached.
+//
+// the engine uses Timer1 of an ATmega328P (an Uno), and the sketch
+// calls `service` from the timer's interrupt, e.g.:
+//
+//   static T6A04AEngine engine(&lcd);
+//
+//   ISR(TIMER1_COMPA_vect) {
+//       engine.service();
+//   }
+//
+//   void setup() {
+//       lcd.init();
+//       engine.start(80);
+//   }
+//
+class T6A04AEngine final : public T6A04AQueue
+{
+private:
+    static_assert(
+        T6A04A_ENGINE_WRITES >= 2 && T6A04A_ENGINE_WRITES <= 128
+            && (T6A04A_ENGINE_WRITES & (T6A04A_ENGINE_WRITES - 1)) == 0,
+        "T6A04A_ENGINE_WRITES must be a power of two up to 128");
+
+    static const u8 MASK = T6A04A_ENGINE_WRITES - 1;
+
+    T6A04A *lcd;
+
+    // each write is DI in bit 8, and the word in bits 0-7.
+    // the writes [tail, head) are queued, and the counters wrap around at 256,
+    // so `head - tail` is the number queued.
+    // only `push` moves the head, and only `service` moves the tail.
+    volatile u16 ring[T6A04A_ENGINE_WRITES];
+    volatile u8 head;
+    volatile u8 tail;
+
+    bool running;
+
+    // see `reset_stats`.
+    u8 high_water;
+    u32 full_waits;
+    volatile u32 drained;
+    u32 stats_ts;
+
+    u8 count() const
+    {
+        return this->head - this->tail;
+    }
+
+public:
+    T6A04AEngine(T6A04A *lcd)
+        : lcd(lcd),
+          head(0),
+          tail(0),
+          running(false),
+          high_water(0),
+          full_waits(0),
+          drained(0),
+          stats_ts(0)
+    {
+    }
+
+    // attach the engine to the panel, and drain it every `period_us` microseconds from Timer1.
+    void start(u16 period_us)
+    {
+#ifdef TIMSK1
+        // CTC mode, at F_CPU / 8.
+        const u32 ticks = u32(period_us) * (F_CPU / 8 / 1000000);
+        if (ticks == 0 || ticks > 0x10000) {
+            Serial.println(F("error: engine period is out of range"));
+            abort();
+        }
+
+        noInterrupts();
+        TCCR1A = 0;
+        TCCR1B = _BV(WGM12) | _BV(CS11);
+        TCNT1 = 0;
+        OCR1A = ticks - 1;
+        TIMSK1 |= _BV(OCIE1A);
+        interrupts();
+
+        this->running = true;
+        this->lcd->attach_queue(this);
+        this->reset_stats();
+#else
+        Serial.println(F("error: the engine needs Timer1 of an AVR"));
+        abort();
+#endif
+    }
+
+    // drain the ring, detach the engine from the panel, and stop the timer.
+    void stop()
+    {
+        this->lcd->attach_queue(NULL);
+
+#ifdef TIMSK1
+        TIMSK1 &= ~_BV(OCIE1A);
+#endif
+        this->running = false;
+    }
+
+    // strobe the oldest queued write, if any.
+    // call this from the timer interrupt, see `start`.
+    //
+    // returns whether a write was strobed.
+    //
+    // cost: one bus operation
+    bool service()
+    {
+        const u8 tail = this->tail;
+        if (tail == this->head) {
+            return false;
+        }
+
+        const u16 write = this->ring[tail & MASK];
+        this->lcd->strobe_write(write >> 8, write & 0xFF);
+
+        // only now may `push` reuse the slot, and `fence` return.
+        this->tail = tail + 1;
+        this->drained += 1;
+        return true;
+    }
+
+    // queue a write, from `loop()` through the panel, see `T6A04A::attach_queue`.
+    // when the ring is full, this waits for the interrupt to make room.
+    virtual void push(bool di, u8 v) override
+    {
+        if (this->count() == T6A04A_ENGINE_WRITES) {
+            this->full_waits += 1;
+            while (this->count() == T6A04A_ENGINE_WRITES) {
+                if (!this->running) {
+                    this->service();
+                }
+            }
+        }
+
+        this->ring[this->head & MASK] = (u16(di) << 8) | v;
+
+        // publish the write only once it's in the ring.
+        this->head = this->head + 1;
+
+        const u8 queued = this->count();
+        if (queued > this->high_water) {
+            this->high_water = queued;
+        }
+    }
+
+    // wait until every queued write has been strobed.
+    // the panel does this itself before reads, see `T6A04A::attach_queue`.
+    //
+    // this must not be called with interrupts disabled, unless the engine is stopped.
+    virtual void fence() override
+    {
+        while (this->tail != this->head) {
+            if (!this->running) {
+                this->service();
+            }
+        }
+    }
+
+    // the number of writes queued.
+    u8 queued() const
+    {
+        return this->count();
+    }
+
+    void reset_stats()
+    {
+        noInterrupts();
+        this->drained = 0;
+        interrupts();
+
+        this->high_water = this->count();
+        this->full_waits = 0;
+        this->stats_ts = micros();
+    }
+
+    // the most writes queued at once since `reset_stats`.
+    u8 high_water_mark() const
+    {
+        return this->high_water;
+    }
+
+    // the number of writes that waited for room in a full ring since `reset_stats`.
+    u32 full_wait_count() const
+    {
+        return this->full_waits;
+    }
+
+    // writes strobed per second since `reset_stats`.
+    float drain_rate() const
+    {
+        noInterrupts();
+        const u32 drained = this->drained;
+        interrupts();
+
+        const u32 elapsed = micros() - this->stats_ts;
+        if (elapsed == 0) {
+            return 0;
+        }
+
+        return float(drained) * 1000000.0 / float(elapsed);
+    }
+};
+
+#endif // ENGINE_H
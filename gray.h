@@ -0,0 +1,274 @@
+#ifndef GRAY_H
+#define GRAY_H
+
+#include "T6A04A.h"
+
+// the four levels of a `T6A04AGray` pixel.
+const uint16_t GRAY_WHITE = 0;
+const uint16_t GRAY_LIGHT = 1;
+const uint16_t GRAY_DARK = 2;
+const uint16_t GRAY_BLACK = 3;
+
+//
+// a 2-bit grayscale surface on a T6A04A,
+// faked by flipping between two bitplanes faster than the eye can follow,
+// as TI-83 software does.
+//
+// the low plane is shown for one of every three flushes,
+// and the high plane for the other two,
+// so a pixel appears on for 0, 1/3, 2/3 or all of the time.
+//
+// the planes are held in RAM: 24 bytes per row, supplied by the caller,
+// so a full screen costs 1536 bytes. an Uno can only afford a band of rows.
+//
+// each flush sends only the words that differ between the plane on the panel
+// and the next plane, plus any rows drawn into since the last flush.
+// call `service` from `loop()` to flush at a steady rate,
+// or `flush` from a timer interrupt if nothing else uses the panel.
+//
+// the achievable plane rate is bounded by the bus:
+// a row that differs in every word costs 14 bus operations.
+//
+class T6A04AGray : public Adafruit_GFX
+{
+private:
+    static const u8 WORDS_PER_ROW = X_COUNT / WordLength::WORD_LENGTH_8;
+
+    // the plane shown by each flush, in order.
+    static const u8 SEQUENCE_LENGTH = 3;
+
+    // no plane has been flushed yet, so the panel content is unknown.
+    static const u8 PLANE_UNKNOWN = 0xFF;
+
+    // writing a short run of unchanged words is cheaper than re-addressing,
+    // which costs two bus operations.
+    static const u8 MERGE_GAP = 2;
+
+    T6A04A *lcd;
+
+    // [plane][row][word], plane 0 holds the low bit of each pixel.
+    u8 *planes;
+    u8 top;
+    u8 rows;
+
+    // one bit per row drawn into since the last flush.
+    u8 dirty[Y_COUNT / 8];
+
+    u8 phase;
+    u8 shown;
+
+    u32 period_us;
+    u32 flush_ts;
+
+    u16 flush_count;
+    u32 stats_ts;
+    u32 min_interval_us;
+    u32 max_interval_us;
+
+    u8 *plane_row(u8 plane, u8 row) const
+    {
+        return &this->planes[(plane * this->rows + row) * WORDS_PER_ROW];
+    }
+
+    void mark_dirty(u8 row)
+    {
+        this->dirty[row / 8] |= 0b10000000 >> (row % 8);
+    }
+
+    bool is_dirty(u8 row) const
+    {
+        return (this->dirty[row / 8] & (0b10000000 >> (row % 8))) != 0;
+    }
+
+    // write words [start, end) of the given plane row to the panel.
+    //
+    // cost: 2 + (end - start) bus operations
+    void write_run(const u8 *words, u8 row, u8 start, u8 end)
+    {
+        this->lcd->set_row(this->top + row);
+        this->lcd->set_column(start);
+        for (u8 i = start; i < end; i++) {
+            this->lcd->write_word(words[i]);
+        }
+    }
+
+public:
+    // `planes` must hold 2 * 12 * `rows` bytes.
+    // the surface covers panel rows [top, top + rows).
+    T6A04AGray(T6A04A *lcd, u8 *planes, u8 rows, u8 top = 0)
+        : Adafruit_GFX(X_COUNT, rows),
+          lcd(lcd),
+          planes(planes),
+          top(top),
+          rows(rows),
+          phase(0),
+          shown(PLANE_UNKNOWN),
+          period_us(1000000 / 150),
+          flush_ts(0)
+    {
+        memset(this->planes, 0, 2 * WORDS_PER_ROW * rows);
+        memset(this->dirty, 0xFF, sizeof(this->dirty));
+        this->reset_stats();
+    }
+
+    // the rate at which `service` flushes planes.
+    void set_plane_rate(u16 hz)
+    {
+        this->period_us = 1000000UL / hz;
+    }
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (x < 0 || x >= this->_width || y < 0 || y >= this->_height) {
+            return;
+        }
+
+        int16_t t;
+        switch (this->rotation) {
+        case 1:
+            t = x;
+            x = this->WIDTH - 1 - y;
+            y = t;
+            break;
+        case 2:
+            x = this->WIDTH - 1 - x;
+            y = this->HEIGHT - 1 - y;
+            break;
+        case 3:
+            t = x;
+            x = y;
+            y = this->HEIGHT - 1 - t;
+            break;
+        }
+
+        const u8 bit = 0b10000000 >> (x % WordLength::WORD_LENGTH_8);
+        u8 *lo = &this->plane_row(0, y)[x / WordLength::WORD_LENGTH_8];
+        u8 *hi = &this->plane_row(1, y)[x / WordLength::WORD_LENGTH_8];
+
+        *lo = (color & 0b01) ? (*lo | bit) : (*lo & ~bit);
+        *hi = (color & 0b10) ? (*hi | bit) : (*hi & ~bit);
+
+        this->mark_dirty(y);
+    }
+
+    virtual void fillScreen(uint16_t color) override
+    {
+        memset(this->plane_row(0, 0), (color & 0b01) ? 0b11111111 : 0b00000000, WORDS_PER_ROW * this->rows);
+        memset(this->plane_row(1, 0), (color & 0b10) ? 0b11111111 : 0b00000000, WORDS_PER_ROW * this->rows);
+        memset(this->dirty, 0xFF, sizeof(this->dirty));
+    }
+
+    // show the next plane in the sequence.
+    //
+    // this may change the counter config and word length.
+    //
+    // cost: up to 14 bus operations per row,
+    // none for rows that are unchanged and equal in both planes.
+    void flush()
+    {
+        static const u8 sequence[SEQUENCE_LENGTH] = { 1, 1, 0 };
+
+        const u32 now = micros();
+        if (this->flush_count != 0) {
+            const u32 interval = now - this->flush_ts;
+            if (interval < this->min_interval_us) {
+                this->min_interval_us = interval;
+            }
+            if (interval > this->max_interval_us) {
+                this->max_interval_us = interval;
+            }
+        }
+        this->flush_ts = now;
+        this->flush_count += 1;
+
+        const u8 next = sequence[this->phase];
+        this->phase = (this->phase + 1) % SEQUENCE_LENGTH;
+
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        for (u8 row = 0; row < this->rows; row++) {
+            const u8 *words = this->plane_row(next, row);
+
+            if (this->shown == PLANE_UNKNOWN || this->is_dirty(row)) {
+                // the panel doesn't hold either plane for this row.
+                this->write_run(words, row, 0, WORDS_PER_ROW);
+                continue;
+            }
+
+            if (this->shown == next) {
+                continue;
+            }
+
+            // write runs of the words that differ between the planes,
+            // merging runs separated by short gaps.
+            const u8 *prev = this->plane_row(this->shown, row);
+            u8 start = 0;
+            while (start < WORDS_PER_ROW) {
+                if (words[start] == prev[start]) {
+                    start += 1;
+                    continue;
+                }
+
+                u8 end = start + 1;
+                for (u8 i = end; i < WORDS_PER_ROW && i - end < MERGE_GAP; i++) {
+                    if (words[i] != prev[i]) {
+                        end = i + 1;
+                    }
+                }
+
+                this->write_run(words, row, start, end);
+                start = end;
+            }
+        }
+
+        memset(this->dirty, 0, sizeof(this->dirty));
+        this->shown = next;
+    }
+
+    // flush the next plane once the plane period has elapsed.
+    // call this often, e.g. from `loop()`.
+    //
+    // returns true if a plane was flushed.
+    bool service()
+    {
+        if ((u32)(micros() - this->flush_ts) < this->period_us) {
+            return false;
+        }
+
+        this->flush();
+        return true;
+    }
+
+    void reset_stats()
+    {
+        this->flush_count = 0;
+        this->stats_ts = micros();
+        this->min_interval_us = 0xFFFFFFFF;
+        this->max_interval_us = 0;
+    }
+
+    // planes flushed per second since `reset_stats`.
+    float plane_rate() const
+    {
+        const u32 elapsed = this->flush_ts - this->stats_ts;
+        if (elapsed == 0) {
+            return 0;
+        }
+
+        return float(this->flush_count) * 1000000.0 / float(elapsed);
+    }
+
+    // the spread between the shortest and longest interval between flushes,
+    // since `reset_stats`, in microseconds.
+    u32 jitter_us() const
+    {
+        if (this->flush_count < 3) {
+            return 0;
+        }
+
+        return this->max_interval_us - this->min_interval_us;
+    }
+};
+
+#endif // GRAY_H
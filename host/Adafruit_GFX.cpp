@@ -0,0 +1,561 @@
+#include "Adafruit_GFX.h"
+
+#include <stdlib.h>
+
+// a stand-in for the classic 5x8 font: each glyph's columns are derived
+// from its character code, so every character draws a distinct shape.
+// the tests only compare the driver against Adafruit_GFX's own `drawChar`,
+// so the shapes don't need to be letters.
+#define GLYPH(c) \
+    (uint8_t)((c) * 37 + 11), (uint8_t)((c) * 53 + 7), (uint8_t)((c) ^ 0x5A), (uint8_t)((c) * 13), (uint8_t)~(c)
+#define GLYPHS_8(c) \
+    GLYPH(c), GLYPH(c + 1), GLYPH(c + 2), GLYPH(c + 3), GLYPH(c + 4), GLYPH(c + 5), GLYPH(c + 6), GLYPH(c + 7)
+#define GLYPHS_64(c) \
+    GLYPHS_8(c), GLYPHS_8(c + 8), GLYPHS_8(c + 16), GLYPHS_8(c + 24), \
+    GLYPHS_8(c + 32), GLYPHS_8(c + 40), GLYPHS_8(c + 48), GLYPHS_8(c + 56)
+
+static const uint8_t glcdfont[256 * 5] = {
+    GLYPHS_64(0), GLYPHS_64(64), GLYPHS_64(128), GLYPHS_64(192),
+};
+
+static void swap_int16(int16_t &a, int16_t &b)
+{
+    const int16_t t = a;
+    a = b;
+    b = t;
+}
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+    : WIDTH(w),
+      HEIGHT(h),
+      _width(w),
+      _height(h),
+      cursor_x(0),
+      cursor_y(0),
+      textcolor(0xFFFF),
+      textbgcolor(0xFFFF),
+      textsize_x(1),
+      textsize_y(1),
+      rotation(0),
+      wrap(true),
+      _cp437(false),
+      gfxFont(NULL)
+{
+}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color)
+{
+    this->drawPixel(x, y, color);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    this->fillRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    this->drawFastVLine(x, y, h, color);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    this->drawFastHLine(x, y, w, color);
+}
+
+// Bresenham, a pixel at a time.
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    const bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        swap_int16(x0, y0);
+        swap_int16(x1, y1);
+    }
+
+    if (x0 > x1) {
+        swap_int16(x0, x1);
+        swap_int16(y0, y1);
+    }
+
+    const int16_t dx = x1 - x0;
+    const int16_t dy = abs(y1 - y0);
+    const int16_t ystep = y0 < y1 ? 1 : -1;
+    int16_t err = dx / 2;
+
+    for (; x0 <= x1; x0++) {
+        if (steep) {
+            this->writePixel(y0, x0, color);
+        } else {
+            this->writePixel(x0, y0, color);
+        }
+
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void Adafruit_GFX::setRotation(uint8_t r)
+{
+    this->rotation = r & 3;
+    if (this->rotation % 2 == 0) {
+        this->_width = this->WIDTH;
+        this->_height = this->HEIGHT;
+    } else {
+        this->_width = this->HEIGHT;
+        this->_height = this->WIDTH;
+    }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    this->startWrite();
+    this->writeLine(x, y, x, y + h - 1, color);
+    this->endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    this->startWrite();
+    this->writeLine(x, y, x + w - 1, y, color);
+    this->endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    this->startWrite();
+    for (int16_t i = x; i < x + w; i++) {
+        this->writeFastVLine(i, y, h, color);
+    }
+    this->endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color)
+{
+    this->fillRect(0, 0, this->_width, this->_height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    if (x0 == x1) {
+        if (y0 > y1) {
+            swap_int16(y0, y1);
+        }
+        this->drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    } else if (y0 == y1) {
+        if (x0 > x1) {
+            swap_int16(x0, x1);
+        }
+        this->drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    } else {
+        this->startWrite();
+        this->writeLine(x0, y0, x1, y1, color);
+        this->endWrite();
+    }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    this->startWrite();
+    this->writeFastHLine(x, y, w, color);
+    this->writeFastHLine(x, y + h - 1, w, color);
+    this->writeFastVLine(x, y, h, color);
+    this->writeFastVLine(x + w - 1, y, h, color);
+    this->endWrite();
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    this->startWrite();
+    this->writePixel(x0, y0 + r, color);
+    this->writePixel(x0, y0 - r, color);
+    this->writePixel(x0 + r, y0, color);
+    this->writePixel(x0 - r, y0, color);
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        this->writePixel(x0 + x, y0 + y, color);
+        this->writePixel(x0 - x, y0 + y, color);
+        this->writePixel(x0 + x, y0 - y, color);
+        this->writePixel(x0 - x, y0 - y, color);
+        this->writePixel(x0 + y, y0 + x, color);
+        this->writePixel(x0 - y, y0 + x, color);
+        this->writePixel(x0 + y, y0 - x, color);
+        this->writePixel(x0 - y, y0 - x, color);
+    }
+    this->endWrite();
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    this->startWrite();
+    this->writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+    this->fillCircleHelper(x0, y0, r, 3, 0, color);
+    this->endWrite();
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color)
+{
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+
+    delta++;
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (x < y + 1) {
+            if (corners & 1) {
+                this->writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+            }
+            if (corners & 2) {
+                this->writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+            }
+        }
+
+        if (y != py) {
+            if (corners & 1) {
+                this->writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+            }
+            if (corners & 2) {
+                this->writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+            }
+            py = y;
+        }
+        px = x;
+    }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+{
+    const int16_t byte_width = (w + 7) / 8;
+    uint8_t b = 0;
+
+    this->startWrite();
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) {
+                b <<= 1;
+            } else {
+                b = pgm_read_byte(&bitmap[j * byte_width + i / 8]);
+            }
+
+            if (b & 0x80) {
+                this->writePixel(x + i, y, color);
+            }
+        }
+    }
+    this->endWrite();
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+    const int16_t byte_width = (w + 7) / 8;
+    uint8_t b = 0;
+
+    this->startWrite();
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) {
+                b <<= 1;
+            } else {
+                b = bitmap[j * byte_width + i / 8];
+            }
+
+            this->writePixel(x + i, y, (b & 0x80) ? color : bg);
+        }
+    }
+    this->endWrite();
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size)
+{
+    this->drawChar(x, y, c, color, bg, size, size);
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y)
+{
+    if (this->gfxFont == NULL) {
+        if (x >= this->_width || y >= this->_height || x + 6 * size_x - 1 < 0 || y + 8 * size_y - 1 < 0) {
+            return;
+        }
+
+        if (!this->_cp437 && c >= 176) {
+            c++;
+        }
+
+        this->startWrite();
+        for (int8_t i = 0; i < 5; i++) {
+            uint8_t line = pgm_read_byte(&glcdfont[c * 5 + i]);
+            for (int8_t j = 0; j < 8; j++, line >>= 1) {
+                if (line & 1) {
+                    if (size_x == 1 && size_y == 1) {
+                        this->writePixel(x + i, y + j, color);
+                    } else {
+                        this->writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, color);
+                    }
+                } else if (bg != color) {
+                    if (size_x == 1 && size_y == 1) {
+                        this->writePixel(x + i, y + j, bg);
+                    } else {
+                        this->writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+                    }
+                }
+            }
+        }
+
+        if (bg != color) {
+            if (size_x == 1 && size_y == 1) {
+                this->writeFastVLine(x + 5, y, 8, bg);
+            } else {
+                this->writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+            }
+        }
+        this->endWrite();
+        return;
+    }
+
+    // a GFXfont glyph only draws its set pixels, whatever the background.
+    c -= (uint8_t)pgm_read_byte(&this->gfxFont->first);
+    const GFXglyph *glyph = &this->gfxFont->glyph[c];
+    const uint8_t *bitmap = this->gfxFont->bitmap;
+
+    uint16_t bo = glyph->bitmapOffset;
+    const uint8_t w = glyph->width;
+    const uint8_t h = glyph->height;
+    const int8_t xo = glyph->xOffset;
+    const int8_t yo = glyph->yOffset;
+    int16_t xo16 = 0;
+    int16_t yo16 = 0;
+    if (size_x > 1 || size_y > 1) {
+        xo16 = xo;
+        yo16 = yo;
+    }
+
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    this->startWrite();
+    for (uint8_t yy = 0; yy < h; yy++) {
+        for (uint8_t xx = 0; xx < w; xx++) {
+            if (!(bit++ & 7)) {
+                bits = pgm_read_byte(&bitmap[bo++]);
+            }
+
+            if (bits & 0x80) {
+                if (size_x == 1 && size_y == 1) {
+                    this->writePixel(x + xo + xx, y + yo + yy, color);
+                } else {
+                    this->writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y, size_x, size_y, color);
+                }
+            }
+            bits <<= 1;
+        }
+    }
+    this->endWrite();
+}
+
+void Adafruit_GFX::setTextSize(uint8_t s)
+{
+    this->textsize_x = s > 0 ? s : 1;
+    this->textsize_y = s > 0 ? s : 1;
+}
+
+void Adafruit_GFX::setFont(const GFXfont *f)
+{
+    if (f != NULL) {
+        if (this->gfxFont == NULL) {
+            // GFXfonts are drawn from their baseline, the classic font from its top.
+            this->cursor_y += 6;
+        }
+    } else if (this->gfxFont != NULL) {
+        this->cursor_y -= 6;
+    }
+    this->gfxFont = (GFXfont *)f;
+}
+
+void Adafruit_GFX::setCursor(int16_t x, int16_t y)
+{
+    this->cursor_x = x;
+    this->cursor_y = y;
+}
+
+void Adafruit_GFX::setTextColor(uint16_t c)
+{
+    // the background is the same as the text: only the text's pixels are drawn.
+    this->textcolor = c;
+    this->textbgcolor = c;
+}
+
+void Adafruit_GFX::setTextColor(uint16_t c, uint16_t bg)
+{
+    this->textcolor = c;
+    this->textbgcolor = bg;
+}
+
+void Adafruit_GFX::setTextWrap(bool w)
+{
+    this->wrap = w;
+}
+
+void Adafruit_GFX::cp437(bool x)
+{
+    this->_cp437 = x;
+}
+
+size_t Adafruit_GFX::write(uint8_t c)
+{
+    if (this->gfxFont == NULL) {
+        if (c == '\n') {
+            this->cursor_x = 0;
+            this->cursor_y += this->textsize_y * 8;
+        } else if (c != '\r') {
+            if (this->wrap && this->cursor_x + this->textsize_x * 6 > this->_width) {
+                this->cursor_x = 0;
+                this->cursor_y += this->textsize_y * 8;
+            }
+            this->drawChar(this->cursor_x, this->cursor_y, c, this->textcolor, this->textbgcolor, this->textsize_x, this->textsize_y);
+            this->cursor_x += this->textsize_x * 6;
+        }
+        return 1;
+    }
+
+    if (c == '\n') {
+        this->cursor_x = 0;
+        this->cursor_y += (int16_t)this->textsize_y * this->gfxFont->yAdvance;
+    } else if (c != '\r') {
+        const uint8_t first = this->gfxFont->first;
+        if (c >= first && c <= (uint8_t)this->gfxFont->last) {
+            const GFXglyph *glyph = &this->gfxFont->glyph[c - first];
+            const uint8_t w = glyph->width;
+            const uint8_t h = glyph->height;
+            if (w > 0 && h > 0) {
+                const int16_t xo = glyph->xOffset;
+                if (this->wrap && this->cursor_x + this->textsize_x * (xo + w) > this->_width) {
+                    this->cursor_x = 0;
+                    this->cursor_y += (int16_t)this->textsize_y * this->gfxFont->yAdvance;
+                }
+                this->drawChar(this->cursor_x, this->cursor_y, c, this->textcolor, this->textbgcolor, this->textsize_x, this->textsize_y);
+            }
+            this->cursor_x += glyph->xAdvance * (int16_t)this->textsize_x;
+        }
+    }
+    return 1;
+}
+
+int16_t Adafruit_GFX::width() const
+{
+    return this->_width;
+}
+
+int16_t Adafruit_GFX::height() const
+{
+    return this->_height;
+}
+
+uint8_t Adafruit_GFX::getRotation() const
+{
+    return this->rotation;
+}
+
+int16_t Adafruit_GFX::getCursorX() const
+{
+    return this->cursor_x;
+}
+
+int16_t Adafruit_GFX::getCursorY() const
+{
+    return this->cursor_y;
+}
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h)
+    : Adafruit_GFX(w, h)
+{
+    const uint16_t bytes = (w + 7) / 8 * h;
+    this->buffer = (uint8_t *)calloc(bytes, 1);
+}
+
+GFXcanvas1::~GFXcanvas1()
+{
+    free(this->buffer);
+}
+
+// map rotated coordinates onto the buffer's, like the library does.
+static void canvas_point(uint8_t rotation, int16_t width, int16_t height, int16_t &x, int16_t &y)
+{
+    int16_t t;
+    switch (rotation) {
+    case 1:
+        t = x;
+        x = width - 1 - y;
+        y = t;
+        break;
+    case 2:
+        x = width - 1 - x;
+        y = height - 1 - y;
+        break;
+    case 3:
+        t = x;
+        x = y;
+        y = height - 1 - t;
+        break;
+    }
+}
+
+void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (x < 0 || y < 0 || x >= this->_width || y >= this->_height) {
+        return;
+    }
+
+    canvas_point(this->rotation, this->WIDTH, this->HEIGHT, x, y);
+
+    uint8_t *p = &this->buffer[x / 8 + y * ((this->WIDTH + 7) / 8)];
+    if (color) {
+        *p |= 0x80 >> (x & 7);
+    } else {
+        *p &= ~(0x80 >> (x & 7));
+    }
+}
+
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const
+{
+    canvas_point(this->rotation, this->WIDTH, this->HEIGHT, x, y);
+    if (x < 0 || y < 0 || x >= this->WIDTH || y >= this->HEIGHT) {
+        return false;
+    }
+
+    return this->buffer[x / 8 + y * ((this->WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+}
+
+void GFXcanvas1::fillScreen(uint16_t color)
+{
+    memset(this->buffer, color ? 0xFF : 0x00, (this->WIDTH + 7) / 8 * this->HEIGHT);
+}
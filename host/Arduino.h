@@ -0,0 +1,182 @@
+//
+// a stub of the Arduino core for the host build, see Makefile.
+// it covers what the driver, the tests and the benchmarks use:
+// the pins and the clock go to the panel model in panel.cpp,
+// and Serial goes to stdout.
+//
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 1
+#define LOW 0
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+#define B00000001 1
+#define B00000010 2
+#define B00000100 4
+#define B00001000 8
+#define B00010000 16
+#define B00100000 32
+#define B01000000 64
+#define B10000000 128
+
+#define _BV(bit) (1 << (bit))
+
+// the host has one address space, so PROGMEM is ordinary memory.
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+#define pgm_read_pointer(address) (*(void *const *)(address))
+
+class __FlashStringHelper;
+#define F(literal) (reinterpret_cast<const __FlashStringHelper *>(literal))
+
+#define noInterrupts()
+#define interrupts()
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+unsigned long micros();
+unsigned long millis();
+void delayMicroseconds(unsigned int us);
+void delay(unsigned long ms);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+class Print
+{
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size-- > 0) {
+            n += this->write(*buffer++);
+        }
+        return n;
+    }
+
+    size_t print(const char *s)
+    {
+        return this->write((const uint8_t *)s, strlen(s));
+    }
+
+    size_t print(const __FlashStringHelper *s)
+    {
+        return this->print(reinterpret_cast<const char *>(s));
+    }
+
+    size_t print(char c)
+    {
+        return this->write((uint8_t)c);
+    }
+
+    size_t print(unsigned char v, int base = DEC)
+    {
+        return this->print((unsigned long)v, base);
+    }
+
+    size_t print(int v, int base = DEC)
+    {
+        return this->print((long)v, base);
+    }
+
+    size_t print(unsigned int v, int base = DEC)
+    {
+        return this->print((unsigned long)v, base);
+    }
+
+    size_t print(long v, int base = DEC)
+    {
+        if (v < 0 && base == DEC) {
+            return this->print('-') + this->print((unsigned long)-v, base);
+        }
+        return this->print((unsigned long)v, base);
+    }
+
+    size_t print(unsigned long v, int base = DEC)
+    {
+        char buffer[8 * sizeof(long) + 1];
+        char *s = &buffer[sizeof(buffer) - 1];
+        *s = '\0';
+        do {
+            const char digit = v % base;
+            *--s = digit < 10 ? '0' + digit : 'A' + digit - 10;
+            v /= base;
+        } while (v != 0);
+        return this->print(s);
+    }
+
+    size_t print(double v, int digits = 2)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.*f", digits, v);
+        return this->print(buffer);
+    }
+
+    size_t println()
+    {
+        return this->print("\r\n");
+    }
+
+    template<typename T>
+    size_t println(T v)
+    {
+        const size_t n = this->print(v);
+        return n + this->println();
+    }
+
+    template<typename T>
+    size_t println(T v, int format)
+    {
+        const size_t n = this->print(v, format);
+        return n + this->println();
+    }
+};
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long baud) {}
+
+    void flush()
+    {
+        fflush(stdout);
+    }
+
+    virtual size_t write(uint8_t c) override
+    {
+        putchar(c);
+        return 1;
+    }
+
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif // ARDUINO_H
@@ -0,0 +1,59 @@
+//
+// a stub of the Arduino EEPROM library for the host build:
+// an Uno's 1 KB of EEPROM, erased, in memory.
+//
+
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <Arduino.h>
+
+class EEPROMClass
+{
+private:
+    uint8_t bytes[1024];
+
+public:
+    EEPROMClass()
+    {
+        memset(this->bytes, 0xFF, sizeof(this->bytes));
+    }
+
+    uint8_t read(int address)
+    {
+        return this->bytes[address];
+    }
+
+    void write(int address, uint8_t v)
+    {
+        this->bytes[address] = v;
+    }
+
+    void update(int address, uint8_t v)
+    {
+        this->bytes[address] = v;
+    }
+
+    template<typename T>
+    T &get(int address, T &t)
+    {
+        memcpy(&t, this->bytes + address, sizeof(T));
+        return t;
+    }
+
+    template<typename T>
+    const T &put(int address, const T &t)
+    {
+        memcpy(this->bytes + address, &t, sizeof(T));
+        return t;
+    }
+
+    uint16_t length()
+    {
+        return sizeof(this->bytes);
+    }
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // EEPROM_H
@@ -0,0 +1,126 @@
+//
+// a stand-in for Adafruit_GFX's FreeSans12pt7b, for the host build.
+//
+// it keeps the font's range and line height, and draws every printable
+// character as the same 12x17 px ring, about the size of the real glyphs,
+// so the text benchmarks do a similar amount of work.
+//
+
+#ifndef FREESANS12PT7B_H
+#define FREESANS12PT7B_H
+
+#include <Arduino.h>
+#include <gfxfont.h>
+
+const uint8_t FreeSans12pt7bBitmaps[] PROGMEM = {
+    0x7F, 0xE8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+    0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x7F, 0xE0,
+};
+
+const GFXglyph FreeSans12pt7bGlyphs[] PROGMEM = {
+    {0, 0, 0, 6, 0, 1}, // 0x20 ' '
+    {0, 12, 17, 14, 1, -17}, // 0x21 '!'
+    {0, 12, 17, 14, 1, -17}, // 0x22 '"'
+    {0, 12, 17, 14, 1, -17}, // 0x23 '#'
+    {0, 12, 17, 14, 1, -17}, // 0x24 '$'
+    {0, 12, 17, 14, 1, -17}, // 0x25 '%'
+    {0, 12, 17, 14, 1, -17}, // 0x26 '&'
+    {0, 12, 17, 14, 1, -17}, // 0x27 '''
+    {0, 12, 17, 14, 1, -17}, // 0x28 '('
+    {0, 12, 17, 14, 1, -17}, // 0x29 ')'
+    {0, 12, 17, 14, 1, -17}, // 0x2A '*'
+    {0, 12, 17, 14, 1, -17}, // 0x2B '+'
+    {0, 12, 17, 14, 1, -17}, // 0x2C ','
+    {0, 12, 17, 14, 1, -17}, // 0x2D '-'
+    {0, 12, 17, 14, 1, -17}, // 0x2E '.'
+    {0, 12, 17, 14, 1, -17}, // 0x2F '/'
+    {0, 12, 17, 14, 1, -17}, // 0x30 '0'
+    {0, 12, 17, 14, 1, -17}, // 0x31 '1'
+    {0, 12, 17, 14, 1, -17}, // 0x32 '2'
+    {0, 12, 17, 14, 1, -17}, // 0x33 '3'
+    {0, 12, 17, 14, 1, -17}, // 0x34 '4'
+    {0, 12, 17, 14, 1, -17}, // 0x35 '5'
+    {0, 12, 17, 14, 1, -17}, // 0x36 '6'
+    {0, 12, 17, 14, 1, -17}, // 0x37 '7'
+    {0, 12, 17, 14, 1, -17}, // 0x38 '8'
+    {0, 12, 17, 14, 1, -17}, // 0x39 '9'
+    {0, 12, 17, 14, 1, -17}, // 0x3A ':'
+    {0, 12, 17, 14, 1, -17}, // 0x3B ';'
+    {0, 12, 17, 14, 1, -17}, // 0x3C '<'
+    {0, 12, 17, 14, 1, -17}, // 0x3D '='
+    {0, 12, 17, 14, 1, -17}, // 0x3E '>'
+    {0, 12, 17, 14, 1, -17}, // 0x3F '?'
+    {0, 12, 17, 14, 1, -17}, // 0x40 '@'
+    {0, 12, 17, 14, 1, -17}, // 0x41 'A'
+    {0, 12, 17, 14, 1, -17}, // 0x42 'B'
+    {0, 12, 17, 14, 1, -17}, // 0x43 'C'
+    {0, 12, 17, 14, 1, -17}, // 0x44 'D'
+    {0, 12, 17, 14, 1, -17}, // 0x45 'E'
+    {0, 12, 17, 14, 1, -17}, // 0x46 'F'
+    {0, 12, 17, 14, 1, -17}, // 0x47 'G'
+    {0, 12, 17, 14, 1, -17}, // 0x48 'H'
+    {0, 12, 17, 14, 1, -17}, // 0x49 'I'
+    {0, 12, 17, 14, 1, -17}, // 0x4A 'J'
+    {0, 12, 17, 14, 1, -17}, // 0x4B 'K'
+    {0, 12, 17, 14, 1, -17}, // 0x4C 'L'
+    {0, 12, 17, 14, 1, -17}, // 0x4D 'M'
+    {0, 12, 17, 14, 1, -17}, // 0x4E 'N'
+    {0, 12, 17, 14, 1, -17}, // 0x4F 'O'
+    {0, 12, 17, 14, 1, -17}, // 0x50 'P'
+    {0, 12, 17, 14, 1, -17}, // 0x51 'Q'
+    {0, 12, 17, 14, 1, -17}, // 0x52 'R'
+    {0, 12, 17, 14, 1, -17}, // 0x53 'S'
+    {0, 12, 17, 14, 1, -17}, // 0x54 'T'
+    {0, 12, 17, 14, 1, -17}, // 0x55 'U'
+    {0, 12, 17, 14, 1, -17}, // 0x56 'V'
+    {0, 12, 17, 14, 1, -17}, // 0x57 'W'
+    {0, 12, 17, 14, 1, -17}, // 0x58 'X'
+    {0, 12, 17, 14, 1, -17}, // 0x59 'Y'
+    {0, 12, 17, 14, 1, -17}, // 0x5A 'Z'
+    {0, 12, 17, 14, 1, -17}, // 0x5B '['
+    {0, 12, 17, 14, 1, -17}, // 0x5C '\\'
+    {0, 12, 17, 14, 1, -17}, // 0x5D ']'
+    {0, 12, 17, 14, 1, -17}, // 0x5E '^'
+    {0, 12, 17, 14, 1, -17}, // 0x5F '_'
+    {0, 12, 17, 14, 1, -17}, // 0x60 '`'
+    {0, 12, 17, 14, 1, -17}, // 0x61 'a'
+    {0, 12, 17, 14, 1, -17}, // 0x62 'b'
+    {0, 12, 17, 14, 1, -17}, // 0x63 'c'
+    {0, 12, 17, 14, 1, -17}, // 0x64 'd'
+    {0, 12, 17, 14, 1, -17}, // 0x65 'e'
+    {0, 12, 17, 14, 1, -17}, // 0x66 'f'
+    {0, 12, 17, 14, 1, -17}, // 0x67 'g'
+    {0, 12, 17, 14, 1, -17}, // 0x68 'h'
+    {0, 12, 17, 14, 1, -17}, // 0x69 'i'
+    {0, 12, 17, 14, 1, -17}, // 0x6A 'j'
+    {0, 12, 17, 14, 1, -17}, // 0x6B 'k'
+    {0, 12, 17, 14, 1, -17}, // 0x6C 'l'
+    {0, 12, 17, 14, 1, -17}, // 0x6D 'm'
+    {0, 12, 17, 14, 1, -17}, // 0x6E 'n'
+    {0, 12, 17, 14, 1, -17}, // 0x6F 'o'
+    {0, 12, 17, 14, 1, -17}, // 0x70 'p'
+    {0, 12, 17, 14, 1, -17}, // 0x71 'q'
+    {0, 12, 17, 14, 1, -17}, // 0x72 'r'
+    {0, 12, 17, 14, 1, -17}, // 0x73 's'
+    {0, 12, 17, 14, 1, -17}, // 0x74 't'
+    {0, 12, 17, 14, 1, -17}, // 0x75 'u'
+    {0, 12, 17, 14, 1, -17}, // 0x76 'v'
+    {0, 12, 17, 14, 1, -17}, // 0x77 'w'
+    {0, 12, 17, 14, 1, -17}, // 0x78 'x'
+    {0, 12, 17, 14, 1, -17}, // 0x79 'y'
+    {0, 12, 17, 14, 1, -17}, // 0x7A 'z'
+    {0, 12, 17, 14, 1, -17}, // 0x7B '{'
+    {0, 12, 17, 14, 1, -17}, // 0x7C '|'
+    {0, 12, 17, 14, 1, -17}, // 0x7D '}'
+    {0, 12, 17, 14, 1, -17}, // 0x7E '~'
+};
+
+const GFXfont FreeSans12pt7b PROGMEM = {
+    (uint8_t *)FreeSans12pt7bBitmaps,
+    (GFXglyph *)FreeSans12pt7bGlyphs,
+    0x20,
+    0x7E,
+    29,
+};
+
+#endif // FREESANS12PT7B_H
@@ -0,0 +1,36 @@
+//
+// a stub of the Arduino SPI library for the host build.
+// the panel model doesn't simulate shift registers, so transfers read back zero.
+//
+
+#ifndef SPI_H
+#define SPI_H
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings
+{
+public:
+    SPISettings() {}
+    SPISettings(uint32_t clock, uint8_t order, uint8_t mode) {}
+};
+
+class SPIClass
+{
+public:
+    void begin() {}
+    void beginTransaction(SPISettings settings) {}
+    void endTransaction() {}
+
+    uint8_t transfer(uint8_t v)
+    {
+        return 0;
+    }
+};
+
+extern SPIClass SPI;
+
+#endif // SPI_H
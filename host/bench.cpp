@@ -0,0 +1,30 @@
+//
+// runs the sketch's benchmarks against the panel model, see Makefile.
+//
+// the times are in the model's costs, so they compare the driver's routines
+// with each other, and a change with its baseline, not with an Uno.
+//
+
+#include "panel.h"
+#include "../opt.h"
+
+// the sketch's pinout.
+static const pin RST = 14;
+static const pin STB = 15;
+static const pin DI = 2;
+static const pin CE = 3;
+static const pin RW = 12;
+static const pin DATA[8] = {11, 10, 9, 8, 7, 6, 5, 4};
+
+int main()
+{
+    panel_bus(DI, RW, DATA);
+    panel_add(CE, RST, STB);
+
+    T6A04A lcd(RST, STB, DI, CE, DATA[7], DATA[6], DATA[5], DATA[4], DATA[3], DATA[2], DATA[1], DATA[0], RW);
+    lcd.init();
+
+    run_benchmarks(&lcd);
+    printf("simulated time: %.1fs\n", panel_time_ns() / 1e9);
+    return 0;
+}
@@ -0,0 +1,44 @@
+//
+// runs the driver's tests and fuzz test against the panel model, see Makefile.
+//
+// usage: fuzz [trials per seed] [seeds]
+//
+
+#include "panel.h"
+#include "../test.h"
+
+// the sketch's pinout.
+static const pin RST = 14;
+static const pin STB = 15;
+static const pin DI = 2;
+static const pin CE = 3;
+static const pin RW = 12;
+static const pin DATA[8] = {11, 10, 9, 8, 7, 6, 5, 4};
+
+int main(int argc, char **argv)
+{
+    const u16 trials = argc > 1 ? atoi(argv[1]) : 500;
+    const u32 seeds = argc > 2 ? atoi(argv[2]) : 4;
+
+    panel_bus(DI, RW, DATA);
+    const Panel *panel = panel_add(CE, RST, STB);
+
+    T6A04A lcd(RST, STB, DI, CE, DATA[7], DATA[6], DATA[5], DATA[4], DATA[3], DATA[2], DATA[1], DATA[0], RW);
+    lcd.init();
+
+    bool ok = test_T6A04A(&lcd);
+    for (u32 seed = 1; seed <= seeds; seed++) {
+        ok = fuzz_T6A04A(&lcd, trials, seed) && ok;
+    }
+
+    printf("operations: %lu, unsettled: %lu, in standby: %lu\n",
+           panel->ops, panel->settle_violations, panel->standby_violations);
+
+    if (!ok || panel->settle_violations > 0 || panel->standby_violations > 0) {
+        printf("FAIL\n");
+        return 1;
+    }
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,16 @@
+//
+// compiles every header of the driver, so that the host build warns about
+// the ones neither the tests nor the benchmarks include.
+//
+
+#include "../T6A04A.h"
+#include "../band.h"
+#include "../calib.h"
+#include "../chart.h"
+#include "../dither.h"
+#include "../engine.h"
+#include "../gray.h"
+#include "../multi.h"
+#include "../scrub.h"
+#include "../shift.h"
+#include "../text.h"
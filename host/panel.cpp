@@ -0,0 +1,267 @@
+#include "panel.h"
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <SPI.h>
+
+HardwareSerial Serial;
+EEPROMClass EEPROM;
+SPIClass SPI;
+
+// the model's costs, in ns: roughly an Uno's, close enough for the driver's
+// timing logic to run the same paths as on a device.
+static const uint32_t DIGITAL_WRITE_NS = 5000;
+static const uint32_t DIGITAL_READ_NS = 5000;
+static const uint32_t PIN_MODE_NS = 4000;
+static const uint32_t MICROS_NS = 3500;
+static const uint32_t SETTLE_NS = 10000;
+
+static const uint8_t PIN_COUNT = 64;
+static const uint8_t MAX_PANELS = 8;
+
+static uint64_t now_ns = 0;
+
+static uint8_t levels[PIN_COUNT];
+// what the panels drive onto the data pins during a read.
+static uint8_t driven[PIN_COUNT];
+
+static uint8_t di_pin = PIN_COUNT - 1;
+static uint8_t rw_pin = PIN_COUNT - 1;
+static uint8_t data_pins[8];
+
+static Panel panels[MAX_PANELS];
+static uint8_t panel_count = 0;
+
+static void reset(Panel *p)
+{
+    p->word_length_8 = true;
+    p->display_on = false;
+    p->counter_y = true;
+    p->counter_up = true;
+    p->row = 0;
+    p->column = 0;
+    p->z = 0;
+}
+
+static void advance(Panel *p)
+{
+    if (p->counter_y) {
+        p->column = p->counter_up ? (p->column + 1) % 32 : (p->column + 31) % 32;
+    } else {
+        p->row = p->counter_up ? (p->row + 1) % PANEL_ROWS : (p->row + PANEL_ROWS - 1) % PANEL_ROWS;
+    }
+}
+
+static bool get_bit(const Panel *p, uint8_t row, uint16_t x)
+{
+    if (x >= PANEL_ROW_BYTES * 8) {
+        return false;
+    }
+    return (p->ram[row][x / 8] >> (7 - x % 8)) & 1;
+}
+
+static void set_bit(Panel *p, uint8_t row, uint16_t x, bool v)
+{
+    if (x >= PANEL_ROW_BYTES * 8) {
+        return;
+    }
+
+    const uint8_t mask = 0x80 >> (x % 8);
+    if (v) {
+        p->ram[row][x / 8] |= mask;
+    } else {
+        p->ram[row][x / 8] &= ~mask;
+    }
+}
+
+static uint8_t get_word(const Panel *p)
+{
+    const uint8_t n = p->word_length_8 ? 8 : 6;
+    const uint16_t x = p->column * n;
+
+    uint8_t word = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        word = (word << 1) | get_bit(p, p->row, x + i);
+    }
+    return word;
+}
+
+static void put_word(Panel *p, uint8_t word)
+{
+    const uint8_t n = p->word_length_8 ? 8 : 6;
+    const uint16_t x = p->column * n;
+
+    for (uint8_t i = 0; i < n; i++) {
+        set_bit(p, p->row, x + i, (word >> (n - 1 - i)) & 1);
+    }
+}
+
+static void instruction(Panel *p, uint8_t v)
+{
+    if (v == 0x00 || v == 0x01) {
+        p->word_length_8 = v;
+    } else if (v == 0x02 || v == 0x03) {
+        p->display_on = v & 1;
+    } else if ((v & 0xFC) == 0x04) {
+        p->counter_y = (v >> 1) & 1;
+        p->counter_up = v & 1;
+    } else if ((v & 0xE0) == 0x20) {
+        p->column = v & 0x1F;
+    } else if ((v & 0xC0) == 0x40) {
+        p->z = v & 0x3F;
+    } else if ((v & 0xC0) == 0x80) {
+        p->row = v & 0x3F;
+    } else if ((v & 0xC0) == 0xC0) {
+        p->contrast = v & 0x3F;
+    }
+}
+
+// CE's rising edge latches the operation.
+static void strobe(Panel *p)
+{
+    p->ops++;
+    if (now_ns < p->busy_until) {
+        p->settle_violations++;
+    }
+    if (p->standby) {
+        p->standby_violations++;
+    }
+
+    const bool data = levels[di_pin];
+    if (!levels[rw_pin]) {
+        uint8_t v = 0;
+        for (uint8_t i = 0; i < 8; i++) {
+            v |= levels[data_pins[i]] << i;
+        }
+
+        if (data) {
+            put_word(p, v);
+            advance(p);
+        } else {
+            instruction(p, v);
+        }
+        p->busy_until = now_ns + SETTLE_NS;
+        return;
+    }
+
+    uint8_t out;
+    if (data) {
+        out = p->latch;
+        p->latch = get_word(p);
+        advance(p);
+    } else {
+        out = (p->word_length_8 << 6) | (p->display_on << 5) | (p->counter_y << 1) | p->counter_up;
+    }
+
+    for (uint8_t i = 0; i < 8; i++) {
+        driven[data_pins[i]] = (out >> i) & 1;
+    }
+}
+
+bool Panel::pixel(uint8_t x, uint8_t y) const
+{
+    return get_bit(this, y, x);
+}
+
+void panel_bus(uint8_t di, uint8_t rw, const uint8_t data[8])
+{
+    di_pin = di;
+    rw_pin = rw;
+    memcpy(data_pins, data, sizeof(data_pins));
+}
+
+Panel *panel_add(uint8_t ce, uint8_t rst, uint8_t stb)
+{
+    Panel *p = &panels[panel_count++];
+    memset(p, 0, sizeof(*p));
+    p->ce = ce;
+    p->rst = rst;
+    p->stb = stb;
+    memset(p->ram, 0xA5, sizeof(p->ram));
+    reset(p);
+    return p;
+}
+
+uint64_t panel_time_ns()
+{
+    return now_ns;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    now_ns += PIN_MODE_NS;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    now_ns += DIGITAL_WRITE_NS;
+
+    const uint8_t old = levels[pin];
+    levels[pin] = value ? HIGH : LOW;
+
+    for (uint8_t i = 0; i < panel_count; i++) {
+        Panel *p = &panels[i];
+        if (pin == p->ce && !old && value) {
+            strobe(p);
+        }
+        if (pin == p->rst && old && !value) {
+            reset(p);
+        }
+        if (pin == p->stb) {
+            p->standby = !value;
+        }
+    }
+}
+
+int digitalRead(uint8_t pin)
+{
+    now_ns += DIGITAL_READ_NS;
+    return driven[pin];
+}
+
+// like an Uno's at 16 MHz, micros() counts in steps of 4 us.
+unsigned long micros()
+{
+    now_ns += MICROS_NS;
+    return (unsigned long)(now_ns / 1000) & ~3ul;
+}
+
+unsigned long millis()
+{
+    return (unsigned long)(now_ns / 1000000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    now_ns += us * 1000ull;
+}
+
+void delay(unsigned long ms)
+{
+    now_ns += ms * 1000000ull;
+}
+
+static unsigned long random_state = 1;
+
+long random(long max)
+{
+    if (max <= 0) {
+        return 0;
+    }
+
+    random_state = random_state * 1103515245 + 12345;
+    return (long)((random_state >> 8) % max);
+}
+
+long random(long min, long max)
+{
+    if (min >= max) {
+        return min;
+    }
+    return min + random(max - min);
+}
+
+void randomSeed(unsigned long seed)
+{
+    random_state = seed;
+}
@@ -0,0 +1,64 @@
+//
+// a model of T6A04A panels on the host stubs' pins, see Makefile.
+//
+// the panels share the data, DI and R/W pins, and each has its own CE, RST
+// and STB, like the sketch's wiring. each pin call advances a simulated clock,
+// which micros() and millis() read, so the benchmarks time the driver's work,
+// though in the model's costs, not an Uno's.
+//
+// the model counts what would go wrong on a device instead of corrupting the
+// display: a strobe before the previous operation has settled, or while the
+// panel is in standby.
+//
+
+#ifndef PANEL_H
+#define PANEL_H
+
+#include <stdint.h>
+
+// the display RAM is 120 px wide, 15 words of 8 bits.
+static const uint8_t PANEL_ROWS = 64;
+static const uint8_t PANEL_ROW_BYTES = 15;
+
+struct Panel
+{
+    uint8_t ce;
+    uint8_t rst;
+    uint8_t stb;
+
+    uint8_t ram[PANEL_ROWS][PANEL_ROW_BYTES];
+
+    // the configuration, as set by instructions and reported by the status word.
+    bool word_length_8;
+    bool display_on;
+    bool counter_y;
+    bool counter_up;
+    uint8_t row;
+    uint8_t column;
+    uint8_t z;
+    uint8_t contrast;
+    bool standby;
+
+    // a data read returns the word latched by the previous one.
+    uint8_t latch;
+
+    // the simulated time until which the last operation is still settling, in ns.
+    uint64_t busy_until;
+
+    unsigned long ops;
+    unsigned long settle_violations;
+    unsigned long standby_violations;
+
+    bool pixel(uint8_t x, uint8_t y) const;
+};
+
+// wire the shared pins, the data pins are in bit order, D0 first.
+void panel_bus(uint8_t di, uint8_t rw, const uint8_t data[8]);
+
+// add a panel, with its RAM filled with garbage like at power on.
+Panel *panel_add(uint8_t ce, uint8_t rst, uint8_t stb);
+
+// the simulated time since start, in ns.
+uint64_t panel_time_ns();
+
+#endif // PANEL_H
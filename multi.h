@@ -0,0 +1,181 @@
+#ifndef MULTI_H
+#define MULTI_H
+
+#include "T6A04A.h"
+
+//
+// several T6A04A panels sharing one data bus (D0-D7, DI and RW),
+// each selected by its own CE line, and optionally its own RST/STB lines.
+//
+// each panel remains its own Adafruit_GFX surface.
+// this adds operations that interleave the bus writes across panels:
+// while one panel settles after a strobe, the next panel is written,
+// so the settle delay is hidden rather than paid once per word per panel.
+//
+// panels that share an STB line enter standby together: time their standby
+// with `set_standby_timeout` and `tick` here, not per panel, or one idle panel
+// would put the others into standby behind their drivers' backs.
+//
+// example, two panels sharing RST and STB:
+//
+//   static T6A04AParallelBus bus(LCD_DI, LCD_D7, LCD_D6, LCD_D5, LCD_D4,
+//                                LCD_D3, LCD_D2, LCD_D1, LCD_D0, LCD_RW);
+//   static T6A04A left(&bus, LCD_RST, LCD_STB, LCD_CE_LEFT);
+//   static T6A04A right(&bus, LCD_RST, LCD_STB, LCD_CE_RIGHT);
+//   static T6A04A *panels[] = { &left, &right };
+//   static T6A04AMulti lcds(panels, 2);
+//
+class T6A04AMulti
+{
+private:
+    T6A04A **panels;
+    u8 count;
+
+    // see `set_standby_timeout`.
+    u32 standby_timeout_ms;
+    u32 timeout_set_ms;
+
+public:
+    T6A04AMulti(T6A04A **panels, u8 count)
+        : panels(panels),
+          count(count),
+          standby_timeout_ms(0),
+          timeout_set_ms(0)
+    {}
+
+    u8 panel_count() const
+    {
+        return this->count;
+    }
+
+    T6A04A *panel(u8 i)
+    {
+        return this->panels[i];
+    }
+
+    // reset every panel before configuring any of them,
+    // since resetting one panel also resets any panel that shares its RST line.
+    void init()
+    {
+        for (u8 i = 0; i < this->count; i++) {
+            this->panels[i]->reset();
+        }
+
+        for (u8 i = 0; i < this->count; i++) {
+            this->panels[i]->configure();
+        }
+    }
+
+    // fill every panel with the given color,
+    // interleaving the word writes across the panels.
+    // like `T6A04A::fillScreen`, this drops each panel's pending words,
+    // and leaves every word known, if the panel has a known map.
+    //
+    // T6A04A_INVERSE has to read back every word, so it fills each panel in turn.
+    //
+    // this may change the counter config and word length.
+    //
+    // cost: 796 bus operations per panel
+    void fillScreen(uint16_t color)
+    {
+        if (T6A04A_INVERSE == color) {
+            for (u8 i = 0; i < this->count; i++) {
+                this->panels[i]->fillScreen(color);
+            }
+            return;
+        }
+
+        const u8 word = 0 == color ? 0b00000000 : 0b11111111;
+
+        for (u8 i = 0; i < this->count; i++) {
+            this->panels[i]->begin_fill(word);
+            this->panels[i]->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+            this->panels[i]->set_word_length(WordLength::WORD_LENGTH_8);
+        }
+
+        for (u8 x = 0; x < (X_COUNT / WordLength::WORD_LENGTH_8); x++) {
+            for (u8 i = 0; i < this->count; i++) {
+                this->panels[i]->set_column(x);
+            }
+
+            for (u8 i = 0; i < this->count; i++) {
+                this->panels[i]->set_row(0);
+            }
+
+            for (u8 y = 0; y < Y_COUNT; y++) {
+                for (u8 i = 0; i < this->count; i++) {
+                    this->panels[i]->write_word(word);
+                }
+            }
+        }
+    }
+
+    // enter standby on every panel once none of them has had a bus operation
+    // for the given duration, as checked by `tick`. zero (the default) never enters standby.
+    //
+    // each panel wakes on its own next bus operation, which also wakes the panels
+    // sharing its STB line. those re-check their configuration on their own next
+    // bus operation, see `T6A04A::wake`, which costs one status read.
+    void set_standby_timeout(u32 idle_ms)
+    {
+        this->standby_timeout_ms = idle_ms;
+        this->timeout_set_ms = millis();
+    }
+
+    // enter standby if every panel has been idle for the standby timeout.
+    // call this regularly, e.g. from `loop()`.
+    //
+    // cost: no bus operations
+    void tick()
+    {
+        if (this->standby_timeout_ms == 0 || millis() - this->timeout_set_ms < this->standby_timeout_ms) {
+            return;
+        }
+
+        for (u8 i = 0; i < this->count; i++) {
+            T6A04A *panel = this->panels[i];
+            if (!panel->is_standby() && panel->idle_ms() < this->standby_timeout_ms) {
+                return;
+            }
+        }
+
+        for (u8 i = 0; i < this->count; i++) {
+            if (!this->panels[i]->is_standby()) {
+                this->panels[i]->enable_standby();
+            }
+        }
+    }
+
+    // cost: 796 bus operations per panel
+    void clear()
+    {
+        this->fillScreen(0);
+    }
+
+    // write `n` words to each panel starting from the given address,
+    // relying on each panel's counter to advance,
+    // interleaving the word writes across the panels.
+    // `words[i]` holds the `n` words for panel `i`.
+    //
+    // this uses each panel's current counter config and word length.
+    //
+    // cost: 2 + n bus operations per panel
+    void write_words_at(u8 row, u8 column, const u8 *const *words, u8 n)
+    {
+        for (u8 i = 0; i < this->count; i++) {
+            this->panels[i]->set_row(row);
+        }
+
+        for (u8 i = 0; i < this->count; i++) {
+            this->panels[i]->set_column(column);
+        }
+
+        for (u8 j = 0; j < n; j++) {
+            for (u8 i = 0; i < this->count; i++) {
+                this->panels[i]->write_word(words[i][j]);
+            }
+        }
+    }
+};
+
+#endif // MULTI_H
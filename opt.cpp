@@ -1,21 +1,34 @@
 #include "T6A04A.h"
 #include "opt.h"
+#include "gray.h"
+#include "band.h"
+#include "text.h"
+#include "dither.h"
+#include "chart.h"
+#include "scrub.h"
+#include "engine.h"
+
+#include <Fonts/FreeSans12pt7b.h>
 
 
 class Benchmark {
 protected:
     // implement these!
     virtual void step(T6A04A *lcd, bool color) = 0;
-    virtual char* name() = 0;
+    virtual const __FlashStringHelper *name() = 0;
+
+    // undo whatever the steps left behind that would skew the next benchmark,
+    // and free whatever they allocated: an Uno can't hold every benchmark's buffers at once.
+    virtual void finish(T6A04A *lcd) {}
 
 public:
     void run(T6A04A *lcd)
     {
         lcd->init();
         lcd->clear();
-        Serial.print("measuring: ");
+        Serial.print(F("measuring: "));
         Serial.print(this->name());
-        Serial.print(": ");
+        Serial.print(F(": "));
 
         const u32 count = 100;
         u32 ts0 = millis();
@@ -28,9 +41,11 @@ public:
 
         u32 ts1 = millis();
 
+        this->finish(lcd);
+
         Serial.print(float(ts1 - ts0) / float(count));
-        Serial.print("ms");
-        Serial.println("");
+        Serial.print(F("ms"));
+        Serial.println();
 
         return;
     }
@@ -38,8 +53,8 @@ public:
 
 // Arduino Uno R3: 0.08ms/op
 class SetColumnBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "set column";
+    virtual const __FlashStringHelper *name() override {
+        return F("set column");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->set_column(0);
@@ -48,8 +63,8 @@ class SetColumnBenchmark : public Benchmark {
 
 // Arduino Uno R3: 0.08ms/op
 class SetRowBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "set row";
+    virtual const __FlashStringHelper *name() override {
+        return F("set row");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->set_row(0);
@@ -58,8 +73,8 @@ class SetRowBenchmark : public Benchmark {
 
 // Arduino Uno R3: 0.08ms/write
 class WriteWordBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "write word";
+    virtual const __FlashStringHelper *name() override {
+        return F("write word");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->write_word(0x00);
@@ -68,8 +83,8 @@ class WriteWordBenchmark : public Benchmark {
 
 // Arduino Uno R3: 0.22ms/write
 class WriteWordAtBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "write word at";
+    virtual const __FlashStringHelper *name() override {
+        return F("write word at");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->write_word_at(0, 0, 0x00);
@@ -78,8 +93,8 @@ class WriteWordAtBenchmark : public Benchmark {
 
 // Arduino Uno R3: 0.08ms/read
 class ReadWordBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "read word";
+    virtual const __FlashStringHelper *name() override {
+        return F("read word");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->read_word();
@@ -88,8 +103,8 @@ class ReadWordBenchmark : public Benchmark {
 
 // Arduino Uno R3: 0.37ms/read
 class ReadWordAtBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "read word at";
+    virtual const __FlashStringHelper *name() override {
+        return F("read word at");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->read_word_at(0, 0);
@@ -98,8 +113,8 @@ class ReadWordAtBenchmark : public Benchmark {
 
 // Arduino Uno R3: 0.62ms/write
 class WritePixelBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "write pixel";
+    virtual const __FlashStringHelper *name() override {
+        return F("write pixel");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->write_pixel(0, 0, color);
@@ -111,8 +126,8 @@ class WritePixelBenchmark : public Benchmark {
 // Arduino Uno R3: 60ms/line
 //
 class NaiveHLineBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "naive hline";
+    virtual const __FlashStringHelper *name() override {
+        return F("naive hline");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         for (u8 x = 0; x < 96; x++) {
@@ -126,8 +141,8 @@ class NaiveHLineBenchmark : public Benchmark {
 // Arduino Uno R3: 1.2ms/line (23x speedup over naive)
 //
 class FastHLineBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "fast hline";
+    virtual const __FlashStringHelper *name() override {
+        return F("fast hline");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->drawFastHLine(0, 0, 96, color);
@@ -137,8 +152,8 @@ class FastHLineBenchmark : public Benchmark {
 // naive vertical line (64px) via write_pixel
 // Arduino Uno R3: 40ms/line
 class NaiveVLineBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "naive vline";
+    virtual const __FlashStringHelper *name() override {
+        return F("naive vline");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         for (u8 y = 0; y < 64; y++) {
@@ -147,11 +162,55 @@ class NaiveVLineBenchmark : public Benchmark {
     }
 };
 
+// optimized vertical line (64px) via drawFastVLine
+class FastVLineBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("fast vline");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->drawFastVLine(0, 0, 64, color);
+    }
+};
+
+// horizontal line (64px) in portrait orientation,
+// which is a vertical run on the panel.
+class RotatedHLineBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("rotated hline");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->setRotation(1);
+        lcd->drawFastHLine(0, 0, 64, color);
+        lcd->setRotation(0);
+    }
+};
+
+// naive diagonal line (96px) via Adafruit_GFX's per-pixel Bresenham
+class NaiveLineBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("naive line");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->Adafruit_GFX::writeLine(0, 0, 95, 63, color);
+    }
+};
+
+// optimized diagonal line (96px) via drawLine,
+// which gathers the pixels into runs
+class FastLineBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("fast line");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->drawLine(0, 0, 95, 63, color);
+    }
+};
+
 // naive 8x8 px rect at (0, 0) via write_pixel
 // Arduino Uno R3: 40ms/rect
 class NaiveAlignedRectBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "naive aligned rect";
+    virtual const __FlashStringHelper *name() override {
+        return F("naive aligned rect");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         for (u8 x = 0; x < 8; x++) {
@@ -165,8 +224,8 @@ class NaiveAlignedRectBenchmark : public Benchmark {
 // optimized 8x8 px rect at (0, 0)
 // Arduino Uno R3: 2.6ms/rect
 class FastAlignedRectBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "fast aligned rect";
+    virtual const __FlashStringHelper *name() override {
+        return F("fast aligned rect");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->fillRect(0, 0, 8, 8, color);
@@ -176,8 +235,8 @@ class FastAlignedRectBenchmark : public Benchmark {
 // naive 8x8 px rect at (4, 4) via write_pixel
 // Arduino Uno R3: 40ms/rect (15x speedup)
 class NaiveUnalignedRectBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "naive unaligned rect";
+    virtual const __FlashStringHelper *name() override {
+        return F("naive unaligned rect");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         for (u8 x = 0; x < 8; x++) {
@@ -191,24 +250,492 @@ class NaiveUnalignedRectBenchmark : public Benchmark {
 // fast 8x8 px rect at (4, 4)
 // Arduino Uno R3: 7ms/rect (5x speedup)
 class FastUnalignedRectBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "fast unaligned rect";
+    virtual const __FlashStringHelper *name() override {
+        return F("fast unaligned rect");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->fillRect(2, 2, 8, 8, color);
     }
 };
 
+// flip every pixel of a 50x40 px rect at (3, 3), which reads back every word it covers
+class InverseRectBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("inverse rect");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->fillRect(3, 3, 50, 40, T6A04A_INVERSE);
+    }
+};
+
+class PatternRectBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("pattern rect");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        static const u8 stipple[8] = {
+            0b10101010, 0b01010101, 0b10101010, 0b01010101,
+            0b10101010, 0b01010101, 0b10101010, 0b01010101,
+        };
+        lcd->fillRectPattern(3, 3, 50, 40, stipple);
+    }
+};
+
+class PushCanvasBenchmark : public Benchmark {
+    GFXcanvas1 *canvas = NULL;
+    virtual const __FlashStringHelper *name() override {
+        return F("push canvas");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->canvas == NULL) {
+            this->canvas = new GFXcanvas1(48, 32);
+            this->canvas->drawCircle(24, 16, 14, 1);
+        }
+        lcd->pushCanvas(*this->canvas, 3, 3);
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete this->canvas;
+        this->canvas = NULL;
+    }
+};
+
+class ScrollRectBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("scroll rect by a pixel");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->copyRect(1, 0, 48, 32, 0, 0);
+    }
+};
+
+class DrawRectBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("draw rect");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->drawRect(3, 3, 50, 40, color);
+    }
+};
+
+class DrawCharBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("draw char");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->drawChar(3, 3, 'A', color, !color, 1);
+    }
+};
+
+class FillCircleBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("fill circle");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->fillCircle(32, 32, 20, color);
+    }
+};
+
 // Arduino Uno R3: 61ms
 class FillScreenBenchmark : public Benchmark {
-    virtual char* name() override {
-        return "fill screen";
+    virtual const __FlashStringHelper *name() override {
+        return F("fill screen");
     }
     virtual void step(T6A04A *lcd, bool color) override {
         lcd->fillScreen(color);
     }
 };
 
+// mirror a word, pixel by pixel,
+// standing in for the per-word work of a bitmap blit.
+static u8 mirror_word(u8 v)
+{
+    u8 r = 0;
+    for (u8 i = 0; i < 8; i++) {
+        r = (r << 1) | (v & 1);
+        v >>= 1;
+    }
+    return r;
+}
+
+// 12 words along a row, waiting for each write to settle
+// before computing the next word, as writes did before they were split-phase.
+class BlockingRowBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("blocking row");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->set_row(0);
+        lcd->set_column(0);
+        for (u8 i = 0; i < X_COUNT / WordLength::WORD_LENGTH_8; i++) {
+            lcd->write_word(mirror_word(i));
+            lcd->wait_ready();
+        }
+    }
+};
+
+// the same 12 words, computing each word while the previous write settles.
+// the difference to "blocking row" is the settle time hidden by the overlap.
+class PipelinedRowBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("pipelined row");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->set_row(0);
+        lcd->set_column(0);
+        for (u8 i = 0; i < X_COUNT / WordLength::WORD_LENGTH_8; i++) {
+            lcd->write_word(mirror_word(i));
+        }
+    }
+};
+
+// enter standby, then write a word, which wakes the panel transparently.
+// see `T6A04A::wake_latency_us` for the wake alone.
+class WakeBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("wake from standby");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->enable_standby();
+        lcd->write_word(0x00);
+    }
+};
+
+#ifdef BENCHMARK_GRAY
+
+// flush one plane of a 16-row grayscale band holding all four levels,
+// so each flush rewrites the words that differ between the planes.
+class GrayFlushBenchmark : public Benchmark {
+    T6A04AGray *gray = NULL;
+    u8 *planes = NULL;
+
+    virtual const __FlashStringHelper *name() override {
+        return F("gray flush (16 rows)");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->gray == NULL) {
+            this->planes = new u8[2 * 12 * 16];
+            this->gray = new T6A04AGray(lcd, this->planes, 16);
+            for (u8 level = 0; level < 4; level++) {
+                this->gray->fillRect(level * 24, 0, 24, 16, level);
+            }
+        }
+        this->gray->flush();
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete this->gray;
+        delete[] this->planes;
+        this->gray = NULL;
+        this->planes = NULL;
+    }
+};
+
+#endif // BENCHMARK_GRAY
+
+// a dashboard where one value changes per update.
+class TextGridBenchmark : public Benchmark {
+    T6A04AText *text = NULL;
+    u16 ticks = 0;
+
+    virtual const __FlashStringHelper *name() override {
+        return F("text grid update");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->text == NULL) {
+            this->text = new T6A04AText(lcd);
+            this->text->println(F("uptime:"));
+            this->text->println(F("status: ok"));
+        }
+        this->ticks += 1;
+        this->text->set_cursor(8, 0);
+        this->text->print(this->ticks);
+        this->text->flush();
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete this->text;
+        this->text = NULL;
+        this->ticks = 0;
+    }
+};
+
+// a typical status screen, for comparing ways of rendering a whole frame.
+static void draw_scene(Adafruit_GFX *gfx)
+{
+    gfx->fillScreen(0);
+    gfx->drawRect(0, 0, 96, 64, 1);
+    gfx->fillRect(2, 2, 92, 10, 1);
+    gfx->drawLine(4, 60, 90, 16, 1);
+    gfx->setCursor(4, 20);
+    gfx->setTextColor(1);
+    gfx->print("T6A04A");
+}
+
+// a triangle wave plotted a sample at a time, sweeping or scrolling.
+class ChartBenchmark : public Benchmark {
+    ChartMode mode;
+    T6A04AChart *chart = NULL;
+    u16 ticks = 0;
+
+public:
+    ChartBenchmark(ChartMode mode) : mode(mode) {}
+
+    virtual const __FlashStringHelper *name() override {
+        if (this->mode == ChartMode::SWEEP) {
+            return F("strip chart sample (sweep)");
+        } else {
+            return F("strip chart sample (scroll)");
+        }
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->chart == NULL) {
+            this->chart = new T6A04AChart(lcd, 0, X_COUNT / WordLength::WORD_LENGTH_8, 0, Y_COUNT, -64, 64);
+            this->chart->set_mode(this->mode);
+        }
+
+        // a triangle wave, a few rows per sample.
+        this->ticks += 1;
+        const int16_t phase = (this->ticks * 3) % 256;
+        this->chart->push_sample(phase < 128 ? phase - 64 : 191 - phase);
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete this->chart;
+        this->chart = NULL;
+        this->ticks = 0;
+    }
+};
+
+#ifdef BENCHMARK_SCRUB
+
+class ScrubBenchmark : public Benchmark {
+    T6A04AScrubber *scrubber = NULL;
+    u8 *shadow = NULL;
+
+    virtual const __FlashStringHelper *name() override {
+        return F("scrub tick (24 bus operations)");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->scrubber == NULL) {
+            this->shadow = new u8[Y_COUNT * X_COUNT / WordLength::WORD_LENGTH_8];
+            this->scrubber = new T6A04AScrubber(lcd, this->shadow, 24);
+            this->scrubber->capture();
+        }
+        this->scrubber->tick();
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete this->scrubber;
+        delete[] this->shadow;
+        this->scrubber = NULL;
+        this->shadow = NULL;
+    }
+};
+
+#endif // BENCHMARK_SCRUB
+
+// a 12pt label in a GFXfont, through Adafruit_GFX's per-pixel `drawChar`,
+// or straight from the glyph bitmaps.
+class FontLabelBenchmark : public Benchmark {
+    bool fast;
+
+public:
+    FontLabelBenchmark(bool fast) : fast(fast) {}
+
+    virtual const __FlashStringHelper *name() override {
+        if (this->fast) {
+            return F("gfxfont label");
+        } else {
+            return F("gfxfont label (per-pixel)");
+        }
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        lcd->setFont(&FreeSans12pt7b);
+        lcd->setCursor(2, 30);
+        lcd->setTextColor(color);
+        if (this->fast) {
+            lcd->print("T6A04A");
+        } else {
+            for (const char *c = "T6A04A"; *c != '\0'; c++) {
+                lcd->Adafruit_GFX::write(*c);
+            }
+        }
+        lcd->setFont(NULL);
+    }
+};
+
+// a cleared screen with a few unaligned shapes, with and without a known map.
+class KnownMapBenchmark : public Benchmark {
+    bool attached;
+    u8 *map = NULL;
+
+public:
+    KnownMapBenchmark(bool attached) : attached(attached) {}
+
+    virtual const __FlashStringHelper *name() override {
+        if (this->attached) {
+            return F("clear and draw (known map)");
+        } else {
+            return F("clear and draw");
+        }
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->attached) {
+            if (this->map == NULL) {
+                this->map = new u8[KNOWN_MAP_BYTES];
+            }
+            lcd->attach_known_map(this->map);
+        }
+        lcd->clear();
+        lcd->fillRect(3, 5, 50, 20, T6A04A_ON);
+        lcd->drawFastHLine(10, 40, 70, T6A04A_ON);
+        lcd->drawFastVLine(90, 2, 60, T6A04A_ON);
+        lcd->attach_known_map(NULL);
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete[] this->map;
+        this->map = NULL;
+    }
+};
+
+#if defined(BENCHMARK_ENGINE) && defined(TIMSK1)
+
+static T6A04AEngine *benchmark_engine = NULL;
+
+ISR(TIMER1_COMPA_vect)
+{
+    if (benchmark_engine != NULL) {
+        benchmark_engine->service();
+    }
+}
+
+// an aligned rect and a millisecond of other work per step,
+// with the writes strobed inline, or from the engine's interrupt meanwhile.
+class EngineBenchmark : public Benchmark {
+    bool queued;
+
+public:
+    EngineBenchmark(bool queued) : queued(queued) {}
+
+    virtual const __FlashStringHelper *name() override {
+        if (this->queued) {
+            return F("aligned rect and work (engine)");
+        } else {
+            return F("aligned rect and work");
+        }
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->queued && benchmark_engine == NULL) {
+            benchmark_engine = new T6A04AEngine(lcd);
+            benchmark_engine->start(80);
+        }
+        lcd->fillRect(0, 0, 32, 8, color);
+        delayMicroseconds(1000);
+    }
+    virtual void finish(T6A04A *lcd) override {
+        if (benchmark_engine != NULL) {
+            Serial.print(F("engine: high water mark "));
+            Serial.print(benchmark_engine->high_water_mark());
+            Serial.print(F(", "));
+            Serial.print(benchmark_engine->drain_rate());
+            Serial.println(F(" writes/s"));
+
+            benchmark_engine->stop();
+            delete benchmark_engine;
+            benchmark_engine = NULL;
+        }
+    }
+};
+
+#endif // BENCHMARK_ENGINE
+
+#ifdef BENCHMARK_DITHER
+
+// a full frame of a diagonal gradient, pushed a row at a time.
+class DitherBenchmark : public Benchmark {
+    DitherMode mode;
+    T6A04ADither *dither = NULL;
+    int16_t *errors = NULL;
+
+public:
+    DitherBenchmark(DitherMode mode) : mode(mode) {}
+
+    virtual const __FlashStringHelper *name() override {
+        if (this->mode == DitherMode::BAYER) {
+            return F("dither frame (bayer)");
+        } else {
+            return F("dither frame (floyd-steinberg)");
+        }
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->dither == NULL) {
+            this->errors = new int16_t[X_COUNT];
+            this->dither = new T6A04ADither(lcd, this->errors, X_COUNT, Y_COUNT);
+            this->dither->set_mode(this->mode);
+        }
+
+        u8 gray[X_COUNT];
+        for (u8 y = 0; y < Y_COUNT; y++) {
+            for (u8 x = 0; x < X_COUNT; x++) {
+                gray[x] = x + y * 2;
+            }
+            this->dither->push_row(gray);
+        }
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete this->dither;
+        delete[] this->errors;
+        this->dither = NULL;
+        this->errors = NULL;
+    }
+};
+
+#endif // BENCHMARK_DITHER
+
+// draw the scene straight onto the panel,
+// reading back whatever each primitive needs to preserve.
+class DirectSceneBenchmark : public Benchmark {
+    virtual const __FlashStringHelper *name() override {
+        return F("direct scene");
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        draw_scene(lcd);
+    }
+};
+
+// render the scene in bands of the given height,
+// trading band buffer RAM (12 bytes per row) against redraws.
+class BandedSceneBenchmark : public Benchmark {
+    const u8 rows;
+    T6A04ABand *band = NULL;
+    u8 *buffer = NULL;
+
+    virtual const __FlashStringHelper *name() override {
+        switch (this->rows) {
+        case 8:
+            return F("banded scene (8 rows)");
+        case 16:
+            return F("banded scene (16 rows)");
+        case 64:
+            return F("banded scene (64 rows)");
+        default:
+            return F("banded scene");
+        }
+    }
+    virtual void step(T6A04A *lcd, bool color) override {
+        if (this->band == NULL) {
+            this->buffer = new u8[12 * this->rows];
+            this->band = new T6A04ABand(lcd, this->buffer, this->rows);
+        }
+        this->band->render(draw_scene);
+    }
+    virtual void finish(T6A04A *lcd) override {
+        delete this->band;
+        delete[] this->buffer;
+        this->band = NULL;
+        this->buffer = NULL;
+    }
+
+public:
+    BandedSceneBenchmark(u8 rows) : rows(rows) {}
+};
+
 static Benchmark *benchmarks[] = {
     new SetColumnBenchmark(),
     new SetRowBenchmark(),
@@ -220,11 +747,52 @@ static Benchmark *benchmarks[] = {
     new NaiveHLineBenchmark(),
     new FastHLineBenchmark(),
     new NaiveVLineBenchmark(),
+    new FastVLineBenchmark(),
+    new RotatedHLineBenchmark(),
+    new NaiveLineBenchmark(),
+    new FastLineBenchmark(),
     new NaiveAlignedRectBenchmark(),
     new FastAlignedRectBenchmark(),
     new NaiveUnalignedRectBenchmark(),
     new FastUnalignedRectBenchmark(),
+    new InverseRectBenchmark(),
+    new PatternRectBenchmark(),
+    new PushCanvasBenchmark(),
+    new ScrollRectBenchmark(),
+    new DrawRectBenchmark(),
+    new DrawCharBenchmark(),
+    new FontLabelBenchmark(false),
+    new FontLabelBenchmark(true),
+    new FillCircleBenchmark(),
     new FillScreenBenchmark(),
+    new BlockingRowBenchmark(),
+    new PipelinedRowBenchmark(),
+    new WakeBenchmark(),
+#ifdef BENCHMARK_GRAY
+    new GrayFlushBenchmark(),
+#endif
+    new TextGridBenchmark(),
+    new ChartBenchmark(ChartMode::SWEEP),
+    new ChartBenchmark(ChartMode::SCROLL),
+#ifdef BENCHMARK_SCRUB
+    new ScrubBenchmark(),
+#endif
+    new KnownMapBenchmark(false),
+    new KnownMapBenchmark(true),
+#if defined(BENCHMARK_ENGINE) && defined(TIMSK1)
+    new EngineBenchmark(false),
+    new EngineBenchmark(true),
+#endif
+#ifdef BENCHMARK_DITHER
+    new DitherBenchmark(DitherMode::BAYER),
+    new DitherBenchmark(DitherMode::FLOYD_STEINBERG),
+#endif
+    new DirectSceneBenchmark(),
+    new BandedSceneBenchmark(8),
+    new BandedSceneBenchmark(16),
+#ifdef BENCHMARK_BAND_64
+    new BandedSceneBenchmark(64),
+#endif
 };
 
 void run_benchmarks(T6A04A *lcd)
@@ -3,6 +3,17 @@
 
 #include "T6A04A.h"
 
+// define this to also benchmark `T6A04AEngine`, see engine.h, which claims Timer1
+// and its interrupt vector for the whole sketch, so it is left out by default.
+// #define BENCHMARK_ENGINE
+
+// define these to also run the benchmarks that allocate a lot of RAM while they run,
+// more than a sketch using most of an Uno's 2 KB can spare.
+// #define BENCHMARK_GRAY    // two planes of a 16-row band, 384 bytes
+// #define BENCHMARK_SCRUB   // a shadow of display RAM, 768 bytes
+// #define BENCHMARK_DITHER  // an error row, 192 bytes, and a row of input on the stack
+// #define BENCHMARK_BAND_64 // a full-screen band, 768 bytes
+
 void run_benchmarks(T6A04A *lcd);
 
 #endif // OPT_H
\ No newline at end of file
@@ -0,0 +1,198 @@
+#ifndef SCRUB_H
+#define SCRUB_H
+
+#include "T6A04A.h"
+
+//
+// repair a panel whose display RAM or configuration was corrupted in the field,
+// such as by ESD or a brown-out resetting the controller,
+// a few words at a time from `loop()`, without noticeably stalling the app.
+//
+// the scrubber keeps a shadow copy of the display RAM (768 bytes, supplied by the caller),
+// and each `tick` compares the next few words of the panel against it
+// with streamed sequential reads, rewriting any word that differs.
+// each tick also reads the status register, and re-applies the word length,
+// counter config and display state when they no longer match the driver's cache,
+// along with the contrast and Z address when the display was turned off.
+//
+// a tick never spends more than its budget of bus operations:
+// words it couldn't afford to repair are checked again on the next tick.
+// when nothing needs repair, a full pass over the panel takes about 768 / (budget - 7) ticks.
+//
+// the shadow must be updated after drawing, with `capture` or `capture_rows`,
+// otherwise the scrubber "repairs" the new drawing back to the old one.
+//
+// example:
+//
+//   static u8 shadow[768];
+//   static T6A04AScrubber scrubber(&lcd, shadow, 24);
+//
+//   void setup() {
+//       ...
+//       draw_screen();
+//       scrubber.capture();
+//   }
+//
+//   void loop() {
+//       scrubber.tick();
+//   }
+//
+class T6A04AScrubber
+{
+private:
+    static const u8 WORDS_PER_ROW = X_COUNT / WordLength::WORD_LENGTH_8;
+
+public:
+    // the smallest useful budget: a status read and five restored registers,
+    // the word length and counter config, an address and dummy read,
+    // one word read, and one word repaired.
+    static const u8 MIN_BUDGET = 6 + 2 + 3 + 1 + 3;
+
+private:
+    T6A04A *lcd;
+
+    // [row][word] of the expected display RAM.
+    u8 *shadow;
+    u8 budget;
+
+    // the next word to check, as row * WORDS_PER_ROW + word.
+    u16 cursor;
+
+    u32 repaired;
+    u32 restored;
+
+public:
+    // `shadow` must hold 768 bytes.
+    // `budget` is the most bus operations spent by one `tick`.
+    T6A04AScrubber(T6A04A *lcd, u8 *shadow, u8 budget)
+        : lcd(lcd),
+          shadow(shadow),
+          budget(budget),
+          cursor(0),
+          repaired(0),
+          restored(0)
+    {
+        if (budget < MIN_BUDGET) {
+            Serial.println(F("error: scrubber budget is too small"));
+            abort();
+        }
+    }
+
+    // copy the rows [start, end) of the panel into the shadow,
+    // after drawing on them.
+    //
+    // this may change the counter config and word length.
+    //
+    // cost: 15 bus operations per row
+    void capture_rows(u8 start, u8 end)
+    {
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        for (u8 row = start; row < end; row++) {
+            this->lcd->set_row(row);
+            this->lcd->set_column(0);
+            this->lcd->read_word(); // dummy
+            for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+                this->shadow[row * WORDS_PER_ROW + column] = this->lcd->read_word();
+            }
+        }
+    }
+
+    // copy the whole panel into the shadow.
+    //
+    // cost: 960 bus operations
+    void capture()
+    {
+        this->capture_rows(0, Y_COUNT);
+    }
+
+    // check the configuration and the next words of the panel, and repair them.
+    // call this regularly, e.g. from `loop()`, outside of a transaction.
+    // nothing happens while the panel is in standby, so scrubbing doesn't wake it.
+    //
+    // this may change the counter config and word length, and the address.
+    //
+    // returns the number of words repaired and registers restored.
+    //
+    // cost: at most `budget` bus operations
+    u8 tick()
+    {
+        if (this->lcd->is_standby()) {
+            return 0;
+        }
+
+        const u32 ops = this->lcd->bus_op_count();
+
+        // a busy panel is still starting up, check it again next tick.
+        u8 restored = 0;
+        Status s = this->lcd->read_status();
+        if (!s.is_busy()) {
+            restored = this->lcd->restore_config(s);
+        }
+
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+        // read as many words as leave room for one repair, within one row.
+        const u8 row = this->cursor / WORDS_PER_ROW;
+        const u8 start = this->cursor % WORDS_PER_ROW;
+        u8 count = this->budget - (this->lcd->bus_op_count() - ops) - 3 - 3;
+        if (count > WORDS_PER_ROW - start) {
+            count = WORDS_PER_ROW - start;
+        }
+
+        u8 words[WORDS_PER_ROW];
+        this->lcd->set_row(row);
+        this->lcd->set_column(start);
+        this->lcd->read_word(); // dummy
+        for (u8 i = 0; i < count; i++) {
+            words[i] = this->lcd->read_word();
+        }
+
+        // repair the words that differ, in order,
+        // writing runs of them sequentially.
+        const u8 *expected = &this->shadow[this->cursor];
+        u8 repaired = 0;
+        u8 next = 0xFF;
+        u8 checked = count;
+        for (u8 i = 0; i < count; i++) {
+            if (words[i] == expected[i]) {
+                continue;
+            }
+
+            const u8 cost = i == next ? 1 : 3;
+            if (this->lcd->bus_op_count() - ops + cost > this->budget) {
+                checked = i;
+                break;
+            }
+
+            if (i != next) {
+                this->lcd->set_row(row);
+                this->lcd->set_column(start + i);
+            }
+            this->lcd->write_word(expected[i]);
+            next = i + 1;
+            repaired += 1;
+        }
+
+        this->cursor = (this->cursor + checked) % (Y_COUNT * WORDS_PER_ROW);
+        this->repaired += repaired;
+        this->restored += restored;
+        return repaired + restored;
+    }
+
+    // the number of words repaired since construction.
+    u32 repaired_words() const
+    {
+        return this->repaired;
+    }
+
+    // the number of registers restored since construction.
+    u32 restored_registers() const
+    {
+        return this->restored;
+    }
+};
+
+#endif // SCRUB_H
@@ -0,0 +1,139 @@
+#ifndef SHIFT_H
+#define SHIFT_H
+
+#include <SPI.h>
+#include "T6A04A.h"
+
+//
+// a bus that drives the data lines through a 74HC595 shift register,
+// and reads them back through a 74HC165, both on hardware SPI.
+// it takes eight pins, MOSI, SCK, MISO, latch, oe, load, DI and RW,
+// where `T6A04AParallelBus` takes ten, D0-D7, DI and RW,
+// so it frees two of the Uno's pins. SPI also keeps SS (D10) an output,
+// so D10 is only free for an output, such as one of latch, oe or load.
+//
+// wiring:
+//
+//   Arduino        74HC595            74HC165            T6A04A
+//   MOSI (D11) --- SER
+//   SCK  (D13) --- SRCLK ------------ CLK
+//   MISO (D12) ---------------------- QH
+//   latch      --- RCLK
+//   oe         --- OE (active low)
+//   load       ---------------------- SH/LD
+//                  QA..QH ----------- A..H ------------- D0..D7
+//                  SRCLR to VCC       CLK INH to GND
+//   di         ------------------------------------------ DI
+//   rw         ------------------------------------------ RW
+//
+// the byte for the next write is shifted out and latched while the panel
+// is still settling from the previous strobe (see `T6A04A::wait_ready`),
+// so at 8MHz the transfer (about 1us) is hidden behind the settle time.
+// the 74HC595 outputs are disabled during reads, so the panel can drive the data lines.
+//
+// the 74HC165 has no output enable, so its QH drives MISO all the time:
+// no other device that drives MISO can share SPI with this bus.
+// devices that only listen, such as a 74HC595 of their own, may share it,
+// since the SPI transfers use transactions.
+//
+class T6A04AShiftBus : public T6A04ABus
+{
+private:
+    pin di;
+    pin rw;
+    pin latch;
+    pin oe;
+    pin load;
+
+    IOMode io_mode;
+
+    SPISettings settings;
+
+    void set_mode(IOMode m)
+    {
+        if (m == this->io_mode) {
+            return;
+        }
+
+        if (OUTPUT == m) {
+            digitalWrite(this->rw, RW_WRITE);
+            digitalWrite(this->oe, LOW);
+        } else if (INPUT == m) {
+            digitalWrite(this->oe, HIGH);
+            digitalWrite(this->rw, RW_READ);
+        } else {
+            Serial.println(F("error: unexpected IO mode"));
+            abort();
+        }
+
+        this->io_mode = m;
+    }
+
+public:
+    T6A04AShiftBus(
+        pin di,
+        pin rw,
+        pin latch,
+        pin oe,
+        pin load,
+        u32 clock_hz = 8000000)
+        : di(di),
+          rw(rw),
+          latch(latch),
+          oe(oe),
+          load(load),
+          io_mode(INPUT),
+          settings(clock_hz, MSBFIRST, SPI_MODE0)
+    {
+        pinMode(this->di, OUTPUT);
+        pinMode(this->rw, OUTPUT);
+        pinMode(this->latch, OUTPUT);
+        pinMode(this->oe, OUTPUT);
+        pinMode(this->load, OUTPUT);
+
+        digitalWrite(this->latch, LOW);
+        digitalWrite(this->load, HIGH);
+
+        SPI.begin();
+        this->set_mode(OUTPUT);
+    }
+
+    // cost: one SPI transfer, and a pulse of the latch
+    virtual void put(bool di, u8 v) override
+    {
+        digitalWrite(this->di, di);
+
+        SPI.beginTransaction(this->settings);
+        SPI.transfer(v);
+        SPI.endTransaction();
+
+        // the outputs change on the rising edge of the latch.
+        digitalWrite(this->latch, HIGH);
+        digitalWrite(this->latch, LOW);
+
+        this->set_mode(OUTPUT);
+    }
+
+    virtual void listen(bool di) override
+    {
+        digitalWrite(this->di, di);
+        this->set_mode(INPUT);
+    }
+
+    // cost: a pulse of the load line, and one SPI transfer
+    virtual u8 get() override
+    {
+        // the 74HC165 samples its inputs while SH/LD is low,
+        // and then presents H (D7) first.
+        digitalWrite(this->load, LOW);
+        digitalWrite(this->load, HIGH);
+
+        SPI.beginTransaction(this->settings);
+        const u8 v = SPI.transfer(0);
+        SPI.endTransaction();
+
+        return v;
+    }
+};
+
+#endif // SHIFT_H
@@ -14,27 +14,27 @@ bool test_T6A04A(T6A04A *lcd)
     Status s = lcd->read_status();
 
     if (s.counter_orientation() != CounterOrientation::ROW_WISE) {
-        Serial.println("FAIL: unexpected counter orientation");
+        Serial.println(F("FAIL: unexpected counter orientation"));
         return false;
     }
 
     if (s.counter_direction() != CounterDirection::INCREMENT) {
-        Serial.println("FAIL: unexpected counter direction");
+        Serial.println(F("FAIL: unexpected counter direction"));
         return false;
     }
 
     if (s.word_length() != WordLength::WORD_LENGTH_8) {
-        Serial.println("FAIL: unexpected word length");
+        Serial.println(F("FAIL: unexpected word length"));
         return false;
     }
 
     if (!s.is_enabled()) {
-        Serial.println("FAIL: unexpected status");
+        Serial.println(F("FAIL: unexpected status"));
         return false;
     }
 
     if (s.is_busy()) {
-        Serial.println("FAIL: unexpected busy");
+        Serial.println(F("FAIL: unexpected busy"));
         return false;
     }
 
@@ -55,12 +55,12 @@ bool test_T6A04A(T6A04A *lcd)
     u8 dummy = lcd->read_word();
 
     if (0b10101010 != lcd->read_word()) {
-        Serial.println("FAIL: unexpected value at (1, 1)");
+        Serial.println(F("FAIL: unexpected value at (1, 1)"));
         return false;
     }
 
     if (0b11111111 != lcd->read_word()) {
-        Serial.println("FAIL: unexpected value at (2, 1)");
+        Serial.println(F("FAIL: unexpected value at (2, 1)"));
         return false;
     }
 
@@ -81,7 +81,518 @@ bool test_T6A04A(T6A04A *lcd)
     // pass
     //
     lcd->clear();
-    Serial.println("PASS");
+    Serial.println(F("PASS"));
 
     return true;
-}
\ No newline at end of file
+}
+
+static const u8 WORDS_PER_ROW = X_COUNT / WordLength::WORD_LENGTH_8;
+
+// the drawing routines exercised by `fuzz_T6A04A`.
+static const u8 FUZZ_HLINE = 0;
+static const u8 FUZZ_VLINE = 1;
+static const u8 FUZZ_RECT = 2;
+static const u8 FUZZ_LINE = 3;
+static const u8 FUZZ_TRANSACTION = 4;
+static const u8 FUZZ_PATTERN = 5;
+static const u8 FUZZ_CANVAS = 6;
+static const u8 FUZZ_FONT = 7;
+static const u8 FUZZ_COPY = 8;
+static const u8 FUZZ_KIND_COUNT = 9;
+
+static const __FlashStringHelper *fuzz_name(u8 kind)
+{
+    switch (kind) {
+    case FUZZ_HLINE:
+        return F("hline");
+    case FUZZ_VLINE:
+        return F("vline");
+    case FUZZ_RECT:
+        return F("rect");
+    case FUZZ_LINE:
+        return F("line");
+    case FUZZ_TRANSACTION:
+        return F("transaction");
+    case FUZZ_PATTERN:
+        return F("pattern");
+    case FUZZ_CANVAS:
+        return F("canvas");
+    case FUZZ_FONT:
+        return F("font");
+    case FUZZ_COPY:
+        return F("copy");
+    default:
+        return F("?");
+    }
+}
+
+// drawn by `pushCanvas`, refilled with random pixels each trial.
+// an odd width exercises the padding at the end of each canvas row.
+static GFXcanvas1 fuzz_canvas(21, 13);
+
+// how far `copyRect` moves the trial's rectangle, chosen each copy trial.
+static int16_t fuzz_copy_dx;
+static int16_t fuzz_copy_dy;
+
+// the patterns of `fillRectPattern`, chosen by the trial's color.
+static const u8 FUZZ_PATTERNS[3][8] = {
+    // 50% stipple
+    { 0b10101010, 0b01010101, 0b10101010, 0b01010101, 0b10101010, 0b01010101, 0b10101010, 0b01010101 },
+    // diagonal hatch
+    { 0b10000000, 0b01000000, 0b00100000, 0b00010000, 0b00001000, 0b00000100, 0b00000010, 0b00000001 },
+    // sparse dots
+    { 0b10001000, 0b00000000, 0b00100010, 0b00000000, 0b10001000, 0b00000000, 0b00100010, 0b00000000 },
+};
+
+// a GFXfont of random glyphs for 'A' to 'F', printed by the font trials.
+// the glyphs have odd widths, so their rows straddle bitmap bytes,
+// offsets to either side of the cursor, and 'D' has no bitmap, like a space.
+static const u8 FUZZ_FONT_BITMAP[] PROGMEM = {
+    0x22, 0xB0, 0xD3, 0x38, 0xA5, 0x19, 0x16, 0x8D, 0x4F, 0xE8, 0x17, 0x70,
+    0x92, 0xBE, 0xCC, 0x0F, 0x7F, 0x46, 0x31, 0xD8, 0xC0, 0xA7, 0xB7, 0x89,
+    0xCC, 0x1A, 0xD3, 0x69, 0x21, 0x82, 0xA3, 0x45, 0xF9, 0x71, 0xA7, 0x82,
+    0xDF, 0xFA, 0xFF, 0xC2, 0x89, 0x0B, 0x4C, 0x05, 0x66, 0x2B, 0x9B, 0x20,
+    0x1B, 0xBF, 0x1D, 0xDF, 0xA7, 0x25, 0xF3, 0x62, 0xDA, 0x98, 0xF6, 0x51,
+    0x85, 0xE1, 0xAE, 0x35, 0x34, 0xD0, 0xFC, 0xE9, 0x2E, 0x24, 0x76, 0x7C,
+    0xD0, 0xAD, 0x04, 0x5B, 0xBE, 0xB8, 0x34, 0x3B, 0x59, 0x86, 0xDB,
+};
+
+static const GFXglyph FUZZ_FONT_GLYPHS[] PROGMEM = {
+    // bitmapOffset, width, height, xAdvance, xOffset, yOffset
+    { 0, 13, 17, 14, 0, -17 },
+    { 28, 1, 12, 3, 1, -12 },
+    { 30, 19, 9, 20, -2, -5 },
+    { 52, 0, 0, 5, 0, 0 },
+    { 52, 7, 30, 8, 1, -22 },
+    { 79, 10, 3, 11, 0, -9 },
+};
+
+static const GFXfont fuzz_font PROGMEM = {
+    (uint8_t *)FUZZ_FONT_BITMAP,
+    (GFXglyph *)FUZZ_FONT_GLYPHS,
+    'A',
+    'F',
+    24,
+};
+
+// the characters printed by a font trial, from 'A' to 'G',
+// so that some fall outside the font.
+static const u8 FUZZ_TEXT_LENGTH = 4;
+
+static char fuzz_text_char(int16_t h, u8 i)
+{
+    return 'A' + ((u16)h >> (3 * i)) % 7;
+}
+
+// set up the text state of a font trial: the cursor at (x, y), and wrapping for odd widths.
+static void begin_fuzz_text(T6A04A *lcd, int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    lcd->setFont(&fuzz_font);
+    lcd->setCursor(x, y);
+    lcd->setTextColor(color);
+    lcd->setTextWrap(w & 1);
+}
+
+// the known map attached for half of the fuzz trials, see `fuzz_T6A04A`.
+static u8 fuzz_known_map[KNOWN_MAP_BYTES];
+
+// fill display RAM with pseudo-random words derived from `seed`,
+// so that a fast path must also preserve the pixels around what it draws.
+//
+// a sparse background is a cleared or filled screen with one random word in eight,
+// so that most words are known to the known map.
+static void fill_background(T6A04A *lcd, u16 seed, bool sparse)
+{
+    if (sparse) {
+        lcd->fillScreen(seed & 1);
+    }
+
+    lcd->set_word_length(WordLength::WORD_LENGTH_8);
+    lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+    for (u8 row = 0; row < Y_COUNT; row++) {
+        lcd->set_row(row);
+        lcd->set_column(0);
+        for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+            seed = seed * 25173 + 13849;
+            if (!sparse) {
+                lcd->write_word(seed >> 8);
+            } else if ((seed & 0b111) == 0) {
+                lcd->write_word_at(row, column, seed >> 8);
+            }
+        }
+    }
+}
+
+// copy display RAM into `words`, [row][column].
+static void read_screen(T6A04A *lcd, u8 *words)
+{
+    lcd->set_word_length(WordLength::WORD_LENGTH_8);
+    lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+
+    for (u8 row = 0; row < Y_COUNT; row++) {
+        lcd->set_row(row);
+        lcd->set_column(0);
+        lcd->read_word(); // dummy
+        for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+            words[row * WORDS_PER_ROW + column] = lcd->read_word();
+        }
+    }
+}
+
+// draw using the optimized routines.
+static void draw_fast(T6A04A *lcd, u8 kind, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    switch (kind) {
+    case FUZZ_HLINE:
+        lcd->drawFastHLine(x, y, w, color);
+        break;
+    case FUZZ_VLINE:
+        lcd->drawFastVLine(x, y, h, color);
+        break;
+    case FUZZ_RECT:
+        lcd->fillRect(x, y, w, h, color);
+        break;
+    case FUZZ_LINE:
+        lcd->drawLine(x, y, x + w, y + h, color);
+        break;
+    case FUZZ_TRANSACTION:
+        lcd->startWrite();
+        lcd->drawFastHLine(x, y, w, color);
+        lcd->drawFastVLine(x, y, h, color);
+        lcd->writeLine(x, y, x + w, y + h, (color + 1) % 3);
+        lcd->fillRectPattern(y, x, h, w, FUZZ_PATTERNS[color]);
+        lcd->endWrite();
+        break;
+    case FUZZ_PATTERN:
+        lcd->fillRectPattern(x, y, w, h, FUZZ_PATTERNS[color]);
+        break;
+    case FUZZ_CANVAS:
+        lcd->pushCanvas(fuzz_canvas, x, y);
+        break;
+    case FUZZ_COPY:
+        lcd->copyRect(x, y, w, h, x + fuzz_copy_dx, y + fuzz_copy_dy);
+        break;
+    case FUZZ_FONT:
+    {
+        char text[FUZZ_TEXT_LENGTH + 1] = { 0 };
+        for (u8 i = 0; i < FUZZ_TEXT_LENGTH; i++) {
+            text[i] = fuzz_text_char(h, i);
+        }
+        begin_fuzz_text(lcd, x, y, w, color);
+        lcd->print(text);
+        break;
+    }
+    }
+}
+
+// paint the pixels [x, x + w) of a row with `drawPixel`.
+// `drawPixel` clips every pixel itself, so the span is only bounded
+// to keep huge spans quick, not to the screen.
+static void draw_reference_hline(T6A04A *lcd, int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    if (w < 0) {
+        x = x + w;
+        w = -w;
+    }
+
+    const int16_t start = x < -8 ? -8 : x;
+    const int16_t end = x + w > X_COUNT + 8 ? X_COUNT + 8 : x + w;
+    for (int16_t i = start; i < end; i++) {
+        lcd->drawPixel(i, y, color);
+    }
+}
+
+static void draw_reference_vline(T6A04A *lcd, int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    if (h < 0) {
+        y = y + h;
+        h = -h;
+    }
+
+    const int16_t start = y < -8 ? -8 : y;
+    const int16_t end = y + h > X_COUNT + 8 ? X_COUNT + 8 : y + h;
+    for (int16_t i = start; i < end; i++) {
+        lcd->drawPixel(x, i, color);
+    }
+}
+
+// the physical location of the rotated (logical) pixel (x, y).
+static void physical_pixel(T6A04A *lcd, int16_t x, int16_t y, int16_t &px, int16_t &py)
+{
+    px = x;
+    py = y;
+    switch (lcd->getRotation()) {
+    case 1:
+        px = X_COUNT - 1 - y;
+        py = x;
+        break;
+    case 2:
+        px = X_COUNT - 1 - x;
+        py = Y_COUNT - 1 - y;
+        break;
+    case 3:
+        px = y;
+        py = Y_COUNT - 1 - x;
+        break;
+    }
+}
+
+static bool on_screen(int16_t px, int16_t py)
+{
+    return px >= 0 && px < X_COUNT && py >= 0 && py < Y_COUNT;
+}
+
+// fill [x, x + w) x [y, y + h) with `pattern` a pixel at a time,
+// looking up each pixel's bit at its physical location.
+static void draw_reference_pattern(T6A04A *lcd, int16_t x, int16_t y, int16_t w, int16_t h, const u8 *pattern)
+{
+    if (w < 0) {
+        x = x + w;
+        w = -w;
+    }
+
+    if (h < 0) {
+        y = y + h;
+        h = -h;
+    }
+
+    for (int16_t j = y < 0 ? 0 : y; j < y + h && j < X_COUNT; j++) {
+        for (int16_t i = x < 0 ? 0 : x; i < x + w && i < X_COUNT; i++) {
+            int16_t px;
+            int16_t py;
+            physical_pixel(lcd, i, j, px, py);
+            if (!on_screen(px, py)) {
+                continue;
+            }
+
+            lcd->drawPixel(i, j, (pattern[py % 8] >> (7 - px % 8)) & 1);
+        }
+    }
+}
+
+// copy [x, x + w) x [y, y + h) by (dx, dy) a pixel at a time, from a snapshot
+// of display RAM in `screen`, so overlapping rectangles need no care.
+// a pixel is copied when both it and its destination are on the screen.
+static void draw_reference_copy(T6A04A *lcd, int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, int16_t dy, u8 *screen)
+{
+    read_screen(lcd, screen);
+
+    for (int16_t j = y < 0 ? 0 : y; j < y + h && j < X_COUNT; j++) {
+        for (int16_t i = x < 0 ? 0 : x; i < x + w && i < X_COUNT; i++) {
+            int16_t px;
+            int16_t py;
+            physical_pixel(lcd, i, j, px, py);
+            int16_t dest_px;
+            int16_t dest_py;
+            physical_pixel(lcd, i + dx, j + dy, dest_px, dest_py);
+            if (!on_screen(px, py) || !on_screen(dest_px, dest_py)) {
+                continue;
+            }
+
+            lcd->drawPixel(i + dx, j + dy, (screen[py * WORDS_PER_ROW + px / 8] >> (7 - px % 8)) & 1);
+        }
+    }
+}
+
+// draw the same thing as `draw_fast`, a pixel at a time,
+// via `drawPixel` and so `write_pixel`.
+// `screen` is scratch space for a copy of display RAM.
+static void draw_reference(T6A04A *lcd, u8 kind, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, u8 *screen)
+{
+    switch (kind) {
+    case FUZZ_HLINE:
+        draw_reference_hline(lcd, x, y, w, color);
+        break;
+    case FUZZ_VLINE:
+        draw_reference_vline(lcd, x, y, h, color);
+        break;
+    case FUZZ_RECT:
+        if (h < 0) {
+            y = y + h;
+            h = -h;
+        }
+        for (int16_t i = y < -8 ? -8 : y; i < y + h && i < X_COUNT + 8; i++) {
+            draw_reference_hline(lcd, x, i, w, color);
+        }
+        break;
+    case FUZZ_LINE:
+        // Adafruit_GFX's Bresenham, which draws with `writePixel`.
+        lcd->Adafruit_GFX::writeLine(x, y, x + w, y + h, color);
+        break;
+    case FUZZ_TRANSACTION:
+        draw_reference_hline(lcd, x, y, w, color);
+        draw_reference_vline(lcd, x, y, h, color);
+        lcd->Adafruit_GFX::writeLine(x, y, x + w, y + h, (color + 1) % 3);
+        draw_reference_pattern(lcd, y, x, h, w, FUZZ_PATTERNS[color]);
+        break;
+    case FUZZ_PATTERN:
+        draw_reference_pattern(lcd, x, y, w, h, FUZZ_PATTERNS[color]);
+        break;
+    case FUZZ_CANVAS:
+        lcd->Adafruit_GFX::drawBitmap(x, y, fuzz_canvas.getBuffer(), fuzz_canvas.width(), fuzz_canvas.height(), T6A04A_ON, T6A04A_OFF);
+        break;
+    case FUZZ_FONT:
+        // Adafruit_GFX's `drawChar`, which draws with `writePixel`.
+        begin_fuzz_text(lcd, x, y, w, color);
+        for (u8 i = 0; i < FUZZ_TEXT_LENGTH; i++) {
+            lcd->Adafruit_GFX::write(fuzz_text_char(h, i));
+        }
+        break;
+    case FUZZ_COPY:
+        draw_reference_copy(lcd, x, y, w, h, fuzz_copy_dx, fuzz_copy_dy, screen);
+        break;
+    }
+}
+
+// a random coordinate or extent, mostly around the screen,
+// but sometimes far outside of it.
+static int16_t random_coordinate(int16_t low, int16_t high)
+{
+    if (random(8) == 0) {
+        return random(-300, 300);
+    }
+    return random(low, high);
+}
+
+//
+// differential test of the optimized drawing routines against `write_pixel`.
+//
+// each trial draws a random primitive (position, extent, rotation,
+// and color including T6A04A_INVERSE, with negative and out-of-range coordinates) twice,
+// over the same random background:
+// once a pixel at a time, and once through the fast path.
+// the resulting display RAM must match byte for byte.
+//
+// the bus operations of both versions are tallied per primitive,
+// so a speedup comes with proof that its output is unchanged.
+//
+// this needs 768 bytes of heap for the expected display RAM.
+//
+bool fuzz_T6A04A(T6A04A *lcd, u16 trials, u32 seed)
+{
+    u8 *expected = (u8 *)malloc(Y_COUNT * WORDS_PER_ROW);
+    if (expected == NULL) {
+        Serial.println(F("FAIL: not enough memory to fuzz"));
+        return false;
+    }
+
+    u32 fast_ops[FUZZ_KIND_COUNT] = { 0 };
+    u32 reference_ops[FUZZ_KIND_COUNT] = { 0 };
+
+    lcd->init();
+    randomSeed(seed);
+    const u32 saved_reads = lcd->saved_read_count();
+
+    bool pass = true;
+    for (u16 trial = 0; trial < trials && pass; trial++) {
+        const u8 kind = random(FUZZ_KIND_COUNT);
+        const u8 rotation = random(4);
+        const int16_t x = random_coordinate(-20, X_COUNT + 20);
+        const int16_t y = random_coordinate(-20, X_COUNT + 20);
+        const int16_t w = random_coordinate(-40, X_COUNT + 40);
+        const int16_t h = random_coordinate(-40, X_COUNT + 40);
+        const uint16_t color = random(3);
+        const u16 background = random(0x10000);
+        const bool sparse = random(2) == 0;
+
+        if (kind == FUZZ_CANVAS) {
+            u8 *pixels = fuzz_canvas.getBuffer();
+            for (u16 i = 0; i < (fuzz_canvas.width() + 7) / 8 * fuzz_canvas.height(); i++) {
+                pixels[i] = random(0x100);
+            }
+        }
+
+        // moves by whole words take the word column path, see `copyRect`.
+        if (kind == FUZZ_COPY) {
+            const bool aligned = random(2) == 0;
+            fuzz_copy_dx = aligned ? random(-3, 4) * 8 : random(-24, 25);
+            fuzz_copy_dy = random(-24, 25);
+        }
+
+        lcd->setRotation(rotation);
+
+        lcd->attach_known_map(NULL);
+        fill_background(lcd, background, sparse);
+        u32 ops = lcd->bus_op_count();
+        draw_reference(lcd, kind, x, y, w, h, color, expected);
+        reference_ops[kind] += lcd->bus_op_count() - ops;
+        read_screen(lcd, expected);
+
+        // on a sparse background, the fast path may skip reading the known words.
+        lcd->attach_known_map(sparse ? fuzz_known_map : NULL);
+        fill_background(lcd, background, sparse);
+        ops = lcd->bus_op_count();
+        draw_fast(lcd, kind, x, y, w, h, color);
+        fast_ops[kind] += lcd->bus_op_count() - ops;
+
+        lcd->set_word_length(WordLength::WORD_LENGTH_8);
+        lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+        for (u8 row = 0; row < Y_COUNT && pass; row++) {
+            lcd->set_row(row);
+            lcd->set_column(0);
+            lcd->read_word(); // dummy
+            for (u8 column = 0; column < WORDS_PER_ROW; column++) {
+                const u8 want = expected[row * WORDS_PER_ROW + column];
+                const u8 got = lcd->read_word();
+                if (got == want) {
+                    continue;
+                }
+
+                Serial.print(F("FAIL: trial "));
+                Serial.print(trial);
+                Serial.print(F(": "));
+                Serial.print(fuzz_name(kind));
+                Serial.print(F(" rotation="));
+                Serial.print(rotation);
+                Serial.print(F(" x="));
+                Serial.print(x);
+                Serial.print(F(" y="));
+                Serial.print(y);
+                Serial.print(F(" w="));
+                Serial.print(w);
+                Serial.print(F(" h="));
+                Serial.print(h);
+                Serial.print(F(" color="));
+                Serial.print(color);
+                Serial.print(F(": word at ("));
+                Serial.print(column);
+                Serial.print(F(", "));
+                Serial.print(row);
+                Serial.print(F(") is "));
+                Serial.print(got, HEX);
+                Serial.print(F(", expected "));
+                Serial.println(want, HEX);
+
+                pass = false;
+                break;
+            }
+        }
+    }
+
+    for (u8 kind = 0; kind < FUZZ_KIND_COUNT; kind++) {
+        Serial.print(F("fuzz: "));
+        Serial.print(fuzz_name(kind));
+        Serial.print(F(": "));
+        Serial.print(fast_ops[kind]);
+        Serial.print(F(" bus operations, per-pixel: "));
+        Serial.println(reference_ops[kind]);
+    }
+
+    Serial.print(F("fuzz: known map saved "));
+    Serial.print(lcd->saved_read_count() - saved_reads);
+    Serial.println(F(" reads"));
+
+    free(expected);
+    lcd->attach_known_map(NULL);
+    lcd->setFont(NULL);
+    lcd->setTextWrap(true);
+    lcd->setRotation(0);
+    lcd->clear();
+
+    if (pass) {
+        Serial.println(F("PASS"));
+    }
+
+    return pass;
+}
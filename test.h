@@ -1,3 +1,5 @@
 #include "T6A04A.h"
 
 bool test_T6A04A(T6A04A *lcd);
+
+bool fuzz_T6A04A(T6A04A *lcd, u16 trials, u32 seed);
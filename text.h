@@ -0,0 +1,274 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include "T6A04A.h"
+
+// the attributes of a `T6A04AText` cell, which may be combined.
+const u8 TEXT_NORMAL = 0;
+const u8 TEXT_INVERSE = 1 << 0;
+const u8 TEXT_UNDERLINE = 1 << 1;
+
+//
+// a 16x8 grid of character cells on a T6A04A, using Adafruit_GFX's 6x8 font,
+// for status screens where only a few values change at a time.
+//
+// the grid holds the character and attributes of each cell,
+// and `flush` redraws only the cells that changed since the last flush.
+// printing the same text into a cell again costs nothing.
+//
+// a cell is exactly one 6-bit word wide, so the panel is switched to 6-bit words
+// and each glyph row is a single word write:
+// an isolated cell is written down its word column (10 bus operations),
+// and runs of changed cells on the same text row are written
+// row by row with sequential writes (8 * (2 + cells) bus operations),
+// whichever is cheaper.
+//
+// the grid covers the whole panel, in its physical orientation.
+//
+// example:
+//
+//   static T6A04AText text(&lcd);
+//
+//   text.set_cursor(0, 0);
+//   text.print("temp: ");
+//   text.print(temperature);
+//   text.flush();
+//
+class T6A04AText final : public Print
+{
+private:
+    static const u8 CELL_WIDTH = WordLength::WORD_LENGTH_6;
+    static const u8 CELL_HEIGHT = 8;
+    static const u8 COLUMNS = X_COUNT / CELL_WIDTH;
+    static const u8 ROWS = Y_COUNT / CELL_HEIGHT;
+
+    // two runs of changed cells separated by one unchanged cell are merged,
+    // if that is cheaper, see `flush`.
+    static const u8 MERGE_GAP = 1;
+
+    T6A04A *lcd;
+
+    u8 chars[ROWS][COLUMNS];
+    u8 attributes[ROWS][COLUMNS];
+
+    // one bit per cell changed since the last flush, per text row.
+    u16 dirty[ROWS];
+
+    u8 cursor_column;
+    u8 cursor_row;
+    u8 attribute;
+
+    // renders a single glyph, see `render_cell`.
+    GFXcanvas1 glyph;
+
+    bool is_dirty(u8 column, u8 row) const
+    {
+        return (this->dirty[row] & (1 << column)) != 0;
+    }
+
+    // the 6-bit words of a cell, top to bottom.
+    void render_cell(u8 column, u8 row, u8 *words)
+    {
+        this->glyph.fillScreen(0);
+        // with the background color equal to the foreground, the background isn't drawn.
+        this->glyph.drawChar(0, 0, this->chars[row][column], 1, 1, 1);
+
+        const u8 *buffer = this->glyph.getBuffer();
+        const u8 attribute = this->attributes[row][column];
+        for (u8 y = 0; y < CELL_HEIGHT; y++) {
+            // canvas rows are MSB-first bytes, 6-bit words are the low bits.
+            u8 word = buffer[y] >> (WordLength::WORD_LENGTH_8 - CELL_WIDTH);
+
+            if ((attribute & TEXT_UNDERLINE) && y == CELL_HEIGHT - 1) {
+                word = 0b00111111;
+            }
+
+            if (attribute & TEXT_INVERSE) {
+                word ^= 0b00111111;
+            }
+
+            words[y] = word;
+        }
+    }
+
+    // the end of the run of changed cells starting at `start`.
+    u8 dirty_run_end(u8 start, u8 row) const
+    {
+        u8 end = start;
+        while (end < COLUMNS && this->is_dirty(end, row)) {
+            end += 1;
+        }
+        return end;
+    }
+
+    // the bus operations of writing a run of `count` cells, see `write_run`:
+    // short runs are written a cell (a word column) at a time, long runs a pixel row at a time.
+    static u16 run_cost(u8 count)
+    {
+        const u16 column_wise = count * (2 + CELL_HEIGHT);
+        const u16 row_wise = CELL_HEIGHT * (2 + count);
+        return column_wise <= row_wise ? column_wise : row_wise;
+    }
+
+    // draw the cells [start, end) of a text row.
+    //
+    // cost: `run_cost` of the cells
+    void write_run(u8 row, u8 start, u8 end)
+    {
+        const u8 count = end - start;
+
+        u8 words[COLUMNS][CELL_HEIGHT];
+        for (u8 i = 0; i < count; i++) {
+            this->render_cell(start + i, row, words[i]);
+        }
+
+        if (count * (2 + CELL_HEIGHT) <= CELL_HEIGHT * (2 + count)) {
+            this->lcd->set_counter_config(CounterOrientation::COLUMN_WISE, CounterDirection::INCREMENT);
+            for (u8 i = 0; i < count; i++) {
+                this->lcd->set_row(row * CELL_HEIGHT);
+                this->lcd->set_column(start + i);
+                for (u8 y = 0; y < CELL_HEIGHT; y++) {
+                    this->lcd->write_word(words[i][y]);
+                }
+            }
+        } else {
+            this->lcd->set_counter_config(CounterOrientation::ROW_WISE, CounterDirection::INCREMENT);
+            for (u8 y = 0; y < CELL_HEIGHT; y++) {
+                this->lcd->set_row(row * CELL_HEIGHT + y);
+                this->lcd->set_column(start);
+                for (u8 i = 0; i < count; i++) {
+                    this->lcd->write_word(words[i][y]);
+                }
+            }
+        }
+    }
+
+public:
+    T6A04AText(T6A04A *lcd)
+        : lcd(lcd),
+          cursor_column(0),
+          cursor_row(0),
+          attribute(TEXT_NORMAL),
+          glyph(CELL_WIDTH, CELL_HEIGHT)
+    {
+        memset(this->chars, ' ', sizeof(this->chars));
+        memset(this->attributes, TEXT_NORMAL, sizeof(this->attributes));
+        this->invalidate();
+    }
+
+    // set the character and attributes of a cell,
+    // marking it for redraw only if either changed.
+    void set_cell(u8 column, u8 row, u8 c, u8 attribute = TEXT_NORMAL)
+    {
+        if (column >= COLUMNS || row >= ROWS) {
+            return;
+        }
+
+        if (this->chars[row][column] == c && this->attributes[row][column] == attribute) {
+            return;
+        }
+
+        this->chars[row][column] = c;
+        this->attributes[row][column] = attribute;
+        this->dirty[row] |= 1 << column;
+    }
+
+    u8 char_at(u8 column, u8 row) const
+    {
+        return this->chars[row][column];
+    }
+
+    // the cell where `print` writes next.
+    void set_cursor(u8 column, u8 row)
+    {
+        this->cursor_column = column;
+        this->cursor_row = row;
+    }
+
+    // the attributes of cells written by `print`.
+    void set_attribute(u8 attribute)
+    {
+        this->attribute = attribute;
+    }
+
+    // blank every cell.
+    void clear()
+    {
+        for (u8 row = 0; row < ROWS; row++) {
+            for (u8 column = 0; column < COLUMNS; column++) {
+                this->set_cell(column, row, ' ');
+            }
+        }
+        this->set_cursor(0, 0);
+    }
+
+    // redraw every cell on the next flush,
+    // such as after something else has drawn on the panel.
+    void invalidate()
+    {
+        memset(this->dirty, 0xFF, sizeof(this->dirty));
+    }
+
+    // write a character at the cursor, for `Print`.
+    // a newline moves to the start of the next text row, wrapping around to the top.
+    virtual size_t write(uint8_t c) override
+    {
+        if (c == '\r') {
+            this->cursor_column = 0;
+            return 1;
+        }
+
+        if (c != '\n') {
+            this->set_cell(this->cursor_column, this->cursor_row, c, this->attribute);
+            this->cursor_column += 1;
+        }
+
+        if (c == '\n' || this->cursor_column >= COLUMNS) {
+            this->cursor_column = 0;
+            this->cursor_row = (this->cursor_row + 1) % ROWS;
+        }
+
+        return 1;
+    }
+
+    using Print::write;
+
+    // redraw the cells that changed since the last flush.
+    //
+    // this changes the word length to 6 bits, and may change the counter config.
+    //
+    // cost: 10 bus operations per isolated changed cell, and less per cell in a run.
+    void flush()
+    {
+        this->lcd->set_word_length(WordLength::WORD_LENGTH_6);
+
+        for (u8 row = 0; row < ROWS; row++) {
+            u8 start = 0;
+            while (start < COLUMNS) {
+                if (!this->is_dirty(start, row)) {
+                    start += 1;
+                    continue;
+                }
+
+                // an unchanged cell costs 8 bus operations in a row-wise run,
+                // and saves addressing each pixel row of the next run again (16),
+                // but merging short runs may turn cheap column-wise runs row-wise.
+                u8 end = this->dirty_run_end(start, row);
+                while (end + MERGE_GAP < COLUMNS && this->is_dirty(end + MERGE_GAP, row)) {
+                    const u8 next_end = this->dirty_run_end(end + MERGE_GAP, row);
+                    if (run_cost(next_end - start) >= run_cost(end - start) + run_cost(next_end - end - MERGE_GAP)) {
+                        break;
+                    }
+                    end = next_end;
+                }
+
+                this->write_run(row, start, end);
+                start = end;
+            }
+
+            this->dirty[row] = 0;
+        }
+    }
+};
+
+#endif // TEXT_H
@@ -0,0 +1,403 @@
+#!/usr/bin/env python3
+"""
+convert images and fonts into PROGMEM headers for the T6A04A driver.
+
+the pixels are packed into display words (MSB is the leftmost pixel,
+see `T6A04A::write_word`) of the chosen word length, and stored in the order
+the panel's counter walks them, so `T6A04A::write_packed` and
+`T6A04A::write_glyph` can stream them with one address setup per line.
+
+  - row-wise assets are stored row by row, left to right.
+  - column-wise assets are stored word column by word column, top to bottom.
+    this suits tall assets, which have fewer word columns than rows.
+
+images may be PBM (P1/P4) or non-interlaced PNG.
+dark pixels (below the threshold) are turned on, and transparent pixels off,
+whether by alpha, palette transparency, or a tRNS colour key.
+fonts are BDF, and every glyph is placed in a cell the size of the font's bounding box.
+
+usage:
+
+    python3 tools/t6a04a_assets.py image logo.png --name logo > logo.h
+    python3 tools/t6a04a_assets.py image logo.pbm --name logo --word-length 6 --orientation column > logo.h
+    python3 tools/t6a04a_assets.py font 6x8.bdf --name small --first 32 --last 126 > small.h
+
+then, in the sketch:
+
+    #include "logo.h"
+    lcd.write_packed(0, 0, logo);
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+class Bitmap:
+    """a monochrome bitmap: `pixels[y][x]` is True for pixels turned on."""
+
+    def __init__(self, width, height, pixels=None):
+        self.width = width
+        self.height = height
+        self.pixels = pixels or [[False] * width for _ in range(height)]
+
+
+def read_pbm(data):
+    tokens = []
+    offset = 0
+
+    # the header is whitespace-separated tokens, with # comments.
+    # for P4, a single whitespace byte follows the last header token.
+    def next_token():
+        nonlocal offset
+        while True:
+            while data[offset:offset + 1].isspace():
+                offset += 1
+            if data[offset:offset + 1] == b"#":
+                while data[offset:offset + 1] not in (b"\n", b""):
+                    offset += 1
+                continue
+            break
+        start = offset
+        while offset < len(data) and not data[offset:offset + 1].isspace():
+            offset += 1
+        return data[start:offset]
+
+    magic = next_token()
+    width = int(next_token())
+    height = int(next_token())
+    bitmap = Bitmap(width, height)
+
+    if magic == b"P1":
+        bits = [c for c in data[offset:].decode("ascii") if c in "01"]
+        for y in range(height):
+            for x in range(width):
+                bitmap.pixels[y][x] = bits[y * width + x] == "1"
+    elif magic == b"P4":
+        offset += 1
+        stride = (width + 7) // 8
+        for y in range(height):
+            row = data[offset + y * stride:offset + (y + 1) * stride]
+            for x in range(width):
+                bitmap.pixels[y][x] = (row[x // 8] >> (7 - x % 8)) & 1 == 1
+    else:
+        raise ValueError("unsupported PBM format: %r" % magic)
+
+    return bitmap
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    if pb <= pc:
+        return b
+    return c
+
+
+def read_png(data, threshold):
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG")
+
+    offset = 8
+    idat = b""
+    palette = []
+    transparency = b""
+    while offset < len(data):
+        (length,) = struct.unpack(">I", data[offset:offset + 4])
+        kind = data[offset + 4:offset + 8]
+        body = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if interlace:
+                raise ValueError("interlaced PNGs are not supported")
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            transparency = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    bits_per_pixel = channels * depth
+    stride = (width * bits_per_pixel + 7) // 8
+    bpp = max(1, bits_per_pixel // 8)
+    raw = zlib.decompress(idat)
+
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        row = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            left = row[i - bpp] if i >= bpp else 0
+            up = previous[i]
+            up_left = previous[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                row[i] = (row[i] + paeth(left, up, up_left)) & 0xFF
+        rows.append(row)
+        previous = row
+
+    def samples(row):
+        # unpack a row into per-pixel channel tuples, at the image's bit depth.
+        if depth == 8:
+            values = list(row)
+        elif depth == 16:
+            values = [(row[i] << 8) | row[i + 1] for i in range(0, len(row), 2)]
+        else:
+            values = []
+            for byte in row:
+                for shift in range(8 - depth, -1, -depth):
+                    values.append((byte >> shift) & ((1 << depth) - 1))
+        return [tuple(values[i * channels:(i + 1) * channels]) for i in range(width)]
+
+    def to_8_bits(value):
+        if depth < 8:
+            return value * (255 // ((1 << depth) - 1))
+        return value >> (depth - 8)
+
+    # for grayscale and truecolour images, tRNS holds a single transparent colour,
+    # as 16-bit samples at the image's bit depth.
+    key = None
+    if color_type == 0 and len(transparency) >= 2:
+        key = struct.unpack(">H", transparency[:2])
+    elif color_type == 2 and len(transparency) >= 6:
+        key = struct.unpack(">HHH", transparency[:6])
+
+    bitmap = Bitmap(width, height)
+    for y, row in enumerate(rows):
+        for x, sample in enumerate(samples(row)):
+            alpha = 255
+            if color_type == 3:
+                index = sample[0]
+                r, g, b = palette[index]
+                if index < len(transparency):
+                    alpha = transparency[index]
+            elif color_type in (0, 4):
+                r = g = b = to_8_bits(sample[0])
+                if color_type == 4:
+                    alpha = to_8_bits(sample[1])
+            else:
+                r, g, b = to_8_bits(sample[0]), to_8_bits(sample[1]), to_8_bits(sample[2])
+                if color_type == 6:
+                    alpha = to_8_bits(sample[3])
+
+            if sample == key:
+                alpha = 0
+
+            luminance = (299 * r + 587 * g + 114 * b) // 1000
+            bitmap.pixels[y][x] = alpha >= 128 and luminance < threshold
+
+    return bitmap
+
+
+def read_image(path, threshold):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:2] in (b"P1", b"P4"):
+        return read_pbm(data)
+    return read_png(data, threshold)
+
+
+def read_bdf(path):
+    """returns the cell size and a dict of encoding to cell-sized `Bitmap`."""
+    with open(path, "r", encoding="latin-1") as f:
+        lines = f.read().splitlines()
+
+    cell_width = cell_height = cell_x = cell_y = 0
+    glyphs = {}
+
+    i = 0
+    while i < len(lines):
+        fields = lines[i].split()
+        i += 1
+        if not fields:
+            continue
+
+        if fields[0] == "FONTBOUNDINGBOX":
+            cell_width, cell_height, cell_x, cell_y = map(int, fields[1:5])
+        elif fields[0] == "STARTCHAR":
+            encoding = -1
+            width = height = x_offset = y_offset = 0
+            while not lines[i].startswith("BITMAP"):
+                fields = lines[i].split()
+                if fields and fields[0] == "ENCODING":
+                    encoding = int(fields[1])
+                elif fields and fields[0] == "BBX":
+                    width, height, x_offset, y_offset = map(int, fields[1:5])
+                i += 1
+            i += 1
+
+            bitmap = Bitmap(cell_width, cell_height)
+            top = (cell_height + cell_y) - (y_offset + height)
+            left = x_offset - cell_x
+            for row in range(height):
+                value = int(lines[i + row], 16)
+                bits = len(lines[i + row].strip()) * 4
+                for column in range(width):
+                    x = left + column
+                    y = top + row
+                    if 0 <= x < cell_width and 0 <= y < cell_height:
+                        bitmap.pixels[y][x] = (value >> (bits - 1 - column)) & 1 == 1
+            i += height
+
+            if encoding >= 0:
+                glyphs[encoding] = bitmap
+
+    return cell_width, cell_height, glyphs
+
+
+def pack(bitmap, word_length, orientation):
+    """pack a bitmap into words, in counter order. returns (words, columns)."""
+    columns = (bitmap.width + word_length - 1) // word_length
+
+    def word(row, column):
+        value = 0
+        for bit in range(word_length):
+            x = column * word_length + bit
+            value <<= 1
+            if x < bitmap.width and bitmap.pixels[row][x]:
+                value |= 1
+        return value
+
+    if orientation == "row":
+        words = [word(row, column) for row in range(bitmap.height) for column in range(columns)]
+    else:
+        words = [word(row, column) for column in range(columns) for row in range(bitmap.height)]
+
+    return words, columns
+
+
+def format_words(words, indent="    ", per_line=12):
+    lines = []
+    for i in range(0, len(words), per_line):
+        lines.append(indent + ", ".join("0x%02x" % w for w in words[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def image_struct(name, words_name, word_length, orientation, columns, rows):
+    return (
+        "    %s,\n"
+        "    WordLength::WORD_LENGTH_%d,\n"
+        "    CounterOrientation::%s,\n"
+        "    %d,\n"
+        "    %d,\n"
+    ) % (words_name, word_length, "ROW_WISE" if orientation == "row" else "COLUMN_WISE", columns, rows)
+
+
+def header(name, source, body):
+    guard = re.sub(r"[^A-Z0-9]", "_", name.upper()) + "_ASSET_H"
+    return (
+        "// generated by tools/t6a04a_assets.py from %s, do not edit.\n"
+        "#ifndef %s\n"
+        "#define %s\n"
+        "\n"
+        "#include \"T6A04A.h\"\n"
+        "\n"
+        "%s"
+        "\n"
+        "#endif // %s\n"
+    ) % (os.path.basename(source), guard, guard, body, guard)
+
+
+def convert_image(args):
+    bitmap = read_image(args.path, args.threshold)
+    if args.invert:
+        bitmap.pixels = [[not p for p in row] for row in bitmap.pixels]
+
+    words, columns = pack(bitmap, args.word_length, args.orientation)
+    if bitmap.height > 64 or columns * args.word_length > 120:
+        raise ValueError("image is larger than the display RAM")
+
+    body = (
+        "// %dx%d pixels, %d-bit words, %s-wise.\n"
+        "static const u8 %s_words[] PROGMEM = {\n%s\n};\n"
+        "\n"
+        "static const PackedImage %s = {\n%s};\n"
+    ) % (
+        bitmap.width, bitmap.height, args.word_length, args.orientation,
+        args.name, format_words(words),
+        args.name, image_struct(args.name, args.name + "_words", args.word_length, args.orientation, columns, bitmap.height),
+    )
+    return header(args.name, args.path, body)
+
+
+def convert_font(args):
+    cell_width, cell_height, glyphs = read_bdf(args.path)
+    blank = Bitmap(cell_width, cell_height)
+
+    chunks = []
+    columns = 0
+    for c in range(args.first, args.last + 1):
+        words, columns = pack(glyphs.get(c, blank), args.word_length, args.orientation)
+        label = chr(c) if 32 < c < 127 and chr(c) not in "\\" else "0x%02x" % c
+        chunks.append("    // %s\n%s" % (label, format_words(words, per_line=cell_height)))
+
+    body = (
+        "// %dx%d cells, %d-bit words, %s-wise, characters %d to %d.\n"
+        "static const u8 %s_glyphs[] PROGMEM = {\n%s\n};\n"
+        "\n"
+        "static const PackedFont %s = {\n    {\n%s    },\n    %d,\n    %d,\n};\n"
+    ) % (
+        cell_width, cell_height, args.word_length, args.orientation, args.first, args.last,
+        args.name, "\n".join(chunks),
+        args.name,
+        "\n".join("    " + line for line in image_struct(args.name, args.name + "_glyphs", args.word_length, args.orientation, columns, cell_height).splitlines()) + "\n",
+        args.first, args.last - args.first + 1,
+    )
+    return header(args.name, args.path, body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="convert images and fonts into PROGMEM headers for the T6A04A driver.")
+    subparsers = parser.add_subparsers(dest="kind", required=True)
+
+    def add_common(p):
+        p.add_argument("path")
+        p.add_argument("--name", required=True, help="C identifier of the asset")
+        p.add_argument("--word-length", type=int, choices=(6, 8), default=8)
+        p.add_argument("--orientation", choices=("row", "column"), default="row")
+
+    image = subparsers.add_parser("image", help="convert a PBM or PNG image")
+    add_common(image)
+    image.add_argument("--threshold", type=int, default=128, help="luminance below which a pixel is on")
+    image.add_argument("--invert", action="store_true", help="turn light pixels on instead")
+
+    font = subparsers.add_parser("font", help="convert a BDF font")
+    add_common(font)
+    font.add_argument("--first", type=int, default=32)
+    font.add_argument("--last", type=int, default=126)
+
+    args = parser.parse_args()
+    if args.kind == "font":
+        # the header stores the range as u8 first and u8 count.
+        if not (0 <= args.first <= 255 and 0 <= args.last <= 255):
+            parser.error("--first and --last must be character codes from 0 to 255")
+        if args.first > args.last:
+            parser.error("--first must not be greater than --last")
+        if args.last - args.first + 1 > 255:
+            parser.error("--first to --last covers %d characters, but a font holds at most 255" % (args.last - args.first + 1))
+
+    if args.kind == "image":
+        sys.stdout.write(convert_image(args))
+    else:
+        sys.stdout.write(convert_font(args))
+
+
+if __name__ == "__main__":
+    main()